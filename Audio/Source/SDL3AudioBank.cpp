@@ -0,0 +1,232 @@
+#include "SDL3AudioBank.h"
+#include "Tbx/Debug/Tracers.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Tbx::Plugins::SDL3Audio
+{
+    // Maps the whole file read-only. The file and mapping handles are released straight
+    // away since the view keeps the mapping alive until it is unmapped.
+    static const Uint8* MapFile(const std::filesystem::path& filepath, size_t& size)
+    {
+        size = 0;
+#ifdef _WIN32
+        HANDLE file = CreateFileW(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return nullptr;
+        }
+
+        LARGE_INTEGER fileSize = {};
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+        {
+            CloseHandle(file);
+            return nullptr;
+        }
+
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (mapping == nullptr)
+        {
+            return nullptr;
+        }
+
+        void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping);
+        if (view == nullptr)
+        {
+            return nullptr;
+        }
+
+        size = static_cast<size_t>(fileSize.QuadPart);
+        return static_cast<const Uint8*>(view);
+#else
+        const int file = open(filepath.c_str(), O_RDONLY);
+        if (file < 0)
+        {
+            return nullptr;
+        }
+
+        struct stat info = {};
+        if (fstat(file, &info) != 0 || info.st_size <= 0)
+        {
+            close(file);
+            return nullptr;
+        }
+
+        void* view = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+        close(file);
+        if (view == MAP_FAILED)
+        {
+            return nullptr;
+        }
+
+        size = static_cast<size_t>(info.st_size);
+        return static_cast<const Uint8*>(view);
+#endif
+    }
+
+    static void UnmapFile(const Uint8* data, size_t size)
+    {
+        if (data == nullptr)
+        {
+            return;
+        }
+
+#ifdef _WIN32
+        UnmapViewOfFile(data);
+#else
+        munmap(const_cast<Uint8*>(data), size);
+#endif
+    }
+
+    // Range check written so untrusted offsets and sizes cannot overflow.
+    static bool FitsWithin(Uint64 offset, Uint64 size, Uint64 total)
+    {
+        return offset <= total && size <= total - offset;
+    }
+
+    Ref<AudioBank> AudioBank::Open(const std::filesystem::path& filepath)
+    {
+        // Constructor is private so the factory can reject files before handing them out.
+        auto bank = Ref<AudioBank>(new AudioBank());
+        bank->_path = filepath;
+        bank->_data = MapFile(filepath, bank->_size);
+        if (bank->_data == nullptr)
+        {
+            TBX_TRACE_ERROR("SDL3Audio: Failed to map audio bank '{}'.", filepath.string());
+            return nullptr;
+        }
+
+        if (!bank->Validate())
+        {
+            TBX_TRACE_ERROR("SDL3Audio: '{}' is not a valid audio bank.", filepath.string());
+            return nullptr;
+        }
+
+        return bank;
+    }
+
+    AudioBank::~AudioBank()
+    {
+        UnmapFile(_data, _size);
+        _data = nullptr;
+        _size = 0;
+    }
+
+    const AudioBankEntry* AudioBank::Find(std::string_view name) const
+    {
+        const AudioBankEntry* entry = Find(HashAudioBankName(name));
+        if (entry == nullptr || GetName(*entry) != name)
+        {
+            return nullptr;
+        }
+        return entry;
+    }
+
+    const AudioBankEntry* AudioBank::Find(Uint64 id) const
+    {
+        // Linear probing over a table the baker sized to at most half full.
+        const Uint32 mask = _header->SlotCount - 1;
+        for (Uint32 probe = 0; probe < _header->SlotCount; ++probe)
+        {
+            const Uint32 slot = _slots[(static_cast<Uint32>(id) + probe) & mask];
+            if (slot == 0 || slot > _header->EntryCount)
+            {
+                return nullptr;
+            }
+
+            const AudioBankEntry& entry = _entries[slot - 1];
+            if (entry.Id == id)
+            {
+                return &entry;
+            }
+        }
+        return nullptr;
+    }
+
+    std::span<const Uint8> AudioBank::GetSamples(const AudioBankEntry& entry) const
+    {
+        return { _data + entry.DataOffset, static_cast<size_t>(entry.DataSize) };
+    }
+
+    std::string_view AudioBank::GetName(const AudioBankEntry& entry) const
+    {
+        const char* names = reinterpret_cast<const char*>(_data + _header->NamesOffset);
+        return { names + entry.NameOffset, entry.NameLength };
+    }
+
+    std::span<const AudioBankEntry> AudioBank::GetEntries() const
+    {
+        return { _entries, _header->EntryCount };
+    }
+
+    const std::filesystem::path& AudioBank::GetPath() const
+    {
+        return _path;
+    }
+
+    bool AudioBank::Validate()
+    {
+        if (_size < sizeof(AudioBankHeader))
+        {
+            return false;
+        }
+
+        const auto* header = reinterpret_cast<const AudioBankHeader*>(_data);
+        if (header->Magic != AudioBankMagic || header->Version != AudioBankVersion || header->FileSize != _size)
+        {
+            return false;
+        }
+
+        const bool slotCountValid = header->SlotCount != 0 && (header->SlotCount & (header->SlotCount - 1)) == 0;
+        const bool slotsValid = FitsWithin(header->SlotsOffset, static_cast<Uint64>(header->SlotCount) * sizeof(Uint32), _size);
+        const bool entriesValid = FitsWithin(header->EntriesOffset, static_cast<Uint64>(header->EntryCount) * sizeof(AudioBankEntry), _size);
+        if (!slotCountValid || header->SlotCount < header->EntryCount || !slotsValid || !entriesValid || header->NamesOffset > _size)
+        {
+            return false;
+        }
+
+        if (header->SlotsOffset % AudioBankAlignment != 0 || header->EntriesOffset % AudioBankAlignment != 0)
+        {
+            return false;
+        }
+
+        // Entries are checked once up front so lookups and playback can trust every offset.
+        const auto* entries = reinterpret_cast<const AudioBankEntry*>(_data + header->EntriesOffset);
+        for (Uint32 i = 0; i < header->EntryCount; ++i)
+        {
+            const AudioBankEntry& entry = entries[i];
+            const bool dataValid = entry.DataOffset % AudioBankAlignment == 0 && FitsWithin(entry.DataOffset, entry.DataSize, _size);
+            const bool nameValid = FitsWithin(entry.NameOffset, entry.NameLength, _size - header->NamesOffset);
+            if (!dataValid || !nameValid)
+            {
+                return false;
+            }
+        }
+
+        // Slots index entries 1-based, with 0 marking an empty slot.
+        const auto* slots = reinterpret_cast<const Uint32*>(_data + header->SlotsOffset);
+        for (Uint32 i = 0; i < header->SlotCount; ++i)
+        {
+            if (slots[i] > header->EntryCount)
+            {
+                return false;
+            }
+        }
+
+        _header = header;
+        _slots = slots;
+        _entries = entries;
+        return true;
+    }
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include "SDL3AudioBankFormat.h"
+#include <Tbx/Audio/Audio.h>
+#include <filesystem>
+#include <span>
+#include <string_view>
+
+namespace Tbx::Plugins::SDL3Audio
+{
+    // A baked audio bank mapped read-only into memory. Opening a bank only maps the file and
+    // validates its header, so the cost does not grow with the number of sounds inside it.
+    class AudioBank
+    {
+    public:
+        static Ref<AudioBank> Open(const std::filesystem::path& filepath);
+        ~AudioBank();
+
+        AudioBank(const AudioBank&) = delete;
+        AudioBank& operator=(const AudioBank&) = delete;
+
+        const AudioBankEntry* Find(std::string_view name) const;
+        const AudioBankEntry* Find(Uint64 id) const;
+
+        std::span<const Uint8> GetSamples(const AudioBankEntry& entry) const;
+        std::string_view GetName(const AudioBankEntry& entry) const;
+        std::span<const AudioBankEntry> GetEntries() const;
+        const std::filesystem::path& GetPath() const;
+
+    private:
+        AudioBank() = default;
+        bool Validate();
+
+    private:
+        std::filesystem::path _path = {};
+        const Uint8* _data = nullptr;
+        size_t _size = 0;
+        const AudioBankHeader* _header = nullptr;
+        const Uint32* _slots = nullptr;
+        const AudioBankEntry* _entries = nullptr;
+    };
+}
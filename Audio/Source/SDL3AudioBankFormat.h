@@ -0,0 +1,63 @@
+#pragma once
+#include <SDL3/SDL_stdinc.h>
+#include <string_view>
+
+// On-disk layout shared by the runtime bank loader and the offline baking tool. Banks are
+// written in host (little-endian) byte order and every section starts on a 64-byte
+// boundary so sample data can be handed to SIMD code and SDL straight from the mapping.
+namespace Tbx::Plugins::SDL3Audio
+{
+    inline constexpr Uint32 AudioBankMagic = 0x4B4E4254; // "TBNK"
+    inline constexpr Uint32 AudioBankVersion = 1;
+    inline constexpr Uint64 AudioBankAlignment = 64;
+    inline constexpr const char* AudioBankExtension = ".tbxbank";
+
+    struct AudioBankHeader
+    {
+        Uint32 Magic = AudioBankMagic;
+        Uint32 Version = AudioBankVersion;
+        Uint32 EntryCount = 0;
+        // Power-of-two size of the open-addressing index. Each slot holds an entry index + 1,
+        // or zero when empty.
+        Uint32 SlotCount = 0;
+        Uint64 SlotsOffset = 0;
+        Uint64 EntriesOffset = 0;
+        Uint64 NamesOffset = 0;
+        Uint64 FileSize = 0;
+        Uint8 Reserved[16] = {};
+    };
+    static_assert(sizeof(AudioBankHeader) == AudioBankAlignment);
+
+    struct AudioBankEntry
+    {
+        // Hash of the sound name, also used as the Uid of the loaded asset.
+        Uint64 Id = 0;
+        Uint64 DataOffset = 0;
+        Uint64 DataSize = 0;
+        Uint32 NameOffset = 0;
+        Uint32 NameLength = 0;
+        Sint32 SampleRate = 0;
+        Sint32 Channels = 0;
+        // SDL_AudioFormat of the stored samples.
+        Uint32 Format = 0;
+        Uint32 Reserved = 0;
+    };
+    static_assert(sizeof(AudioBankEntry) == 48);
+
+    // 64-bit FNV-1a, used both when baking and when looking sounds up by name.
+    constexpr Uint64 HashAudioBankName(std::string_view name)
+    {
+        Uint64 hash = 0xcbf29ce484222325ull;
+        for (const char c : name)
+        {
+            hash ^= static_cast<Uint8>(c);
+            hash *= 0x100000001b3ull;
+        }
+        return hash;
+    }
+
+    constexpr Uint64 AlignAudioBankOffset(Uint64 offset)
+    {
+        return (offset + AudioBankAlignment - 1) & ~(AudioBankAlignment - 1);
+    }
+}
@@ -0,0 +1,184 @@
+#include "SDL3AudioCapture.h"
+#include "SDL3AudioDsp.h"
+#include "Tbx/Debug/Tracers.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Tbx::Plugins::SDL3Audio
+{
+    // Frames processed per pass of the capture callback; sizes the scratch buffer.
+    static constexpr size_t CaptureBlockFrames = 480;
+
+    AudioCapture::~AudioCapture()
+    {
+        Close();
+    }
+
+    bool AudioCapture::Open(const CaptureSettings& settings)
+    {
+        Close();
+
+        _settings = settings;
+        _spec.format = SDL_AUDIO_F32;
+        _spec.channels = std::clamp(settings.Channels, 1, 8);
+        _spec.freq = std::max(settings.SampleRate, 8000);
+
+        const size_t channels = static_cast<size_t>(_spec.channels);
+        const double framesPerMs = static_cast<double>(_spec.freq) / 1000.0;
+        const size_t maxLatencyFrames = std::max<size_t>(CaptureBlockFrames, static_cast<size_t>(std::max(settings.MaxLatencyMs, 1.0f) * framesPerMs));
+        _maxBufferedSamples = maxLatencyFrames * channels;
+        _hangoverFrames = static_cast<size_t>(std::max(settings.VoiceHangoverMs, 0.0f) * framesPerMs);
+        _framesSinceVoice = _hangoverFrames;
+        _ring.Reset(_maxBufferedSamples + CaptureBlockFrames * channels, channels);
+        _scratch.assign(CaptureBlockFrames * channels, 0.0f);
+        _gain.store(settings.Gain, std::memory_order_relaxed);
+        _levelDb.store(-100.0f, std::memory_order_relaxed);
+        _voiceActive.store(false, std::memory_order_relaxed);
+        _capturedFrames.store(0, std::memory_order_relaxed);
+        _droppedFrames.store(0, std::memory_order_relaxed);
+
+        // SDL converts from whatever the device provides to the requested float format.
+        _stream = SDL_OpenAudioDeviceStream(SDL_AUDIO_DEVICE_DEFAULT_RECORDING, &_spec, OnCaptured, this);
+        if (_stream == nullptr)
+        {
+            TBX_TRACE_ERROR("SDL3Audio: Failed to open recording device: {}", SDL_GetError());
+            return false;
+        }
+
+        if (!SDL_ResumeAudioStreamDevice(_stream))
+        {
+            TBX_TRACE_ERROR("SDL3Audio: Failed to start recording device: {}", SDL_GetError());
+            Close();
+            return false;
+        }
+
+        TBX_TRACE_INFO("SDL3Audio: Capturing at {} Hz, {} channels", _spec.freq, _spec.channels);
+        return true;
+    }
+
+    void AudioCapture::Close()
+    {
+        if (_stream == nullptr)
+        {
+            return;
+        }
+
+        // Destroying a device stream closes the device and waits for the callback to finish.
+        SDL_DestroyAudioStream(_stream);
+        _stream = nullptr;
+        _voiceActive.store(false, std::memory_order_relaxed);
+    }
+
+    bool AudioCapture::IsOpen() const
+    {
+        return _stream != nullptr;
+    }
+
+    size_t AudioCapture::Read(float* frames, size_t frameCount)
+    {
+        if (_stream == nullptr)
+        {
+            return 0;
+        }
+
+        // Keep latency bounded: anything older than MaxLatencyMs is stale for real-time use.
+        const size_t channels = static_cast<size_t>(_spec.channels);
+        const size_t readable = _ring.GetReadable();
+        if (readable > _maxBufferedSamples)
+        {
+            const size_t trimmed = _ring.Discard(readable - _maxBufferedSamples);
+            _droppedFrames.fetch_add(trimmed / channels, std::memory_order_relaxed);
+        }
+
+        return _ring.Read(frames, frameCount * channels) / channels;
+    }
+
+    void AudioCapture::SetGain(float gain)
+    {
+        _gain.store(gain, std::memory_order_relaxed);
+    }
+
+    bool AudioCapture::IsVoiceActive() const
+    {
+        return _voiceActive.load(std::memory_order_relaxed);
+    }
+
+    CaptureStats AudioCapture::GetStats() const
+    {
+        CaptureStats stats = {};
+        stats.CapturedFrames = _capturedFrames.load(std::memory_order_relaxed);
+        stats.DroppedFrames = _droppedFrames.load(std::memory_order_relaxed);
+        stats.LevelDb = _levelDb.load(std::memory_order_relaxed);
+        if (_spec.freq > 0 && _spec.channels > 0)
+        {
+            const size_t bufferedFrames = _ring.GetReadable() / static_cast<size_t>(_spec.channels);
+            stats.BufferedMs = static_cast<float>(bufferedFrames) * 1000.0f / static_cast<float>(_spec.freq);
+        }
+        return stats;
+    }
+
+    const SDL_AudioSpec& AudioCapture::GetSpec() const
+    {
+        return _spec;
+    }
+
+    void AudioCapture::OnCaptured(void* userdata, SDL_AudioStream* stream, int additionalAmount, int totalAmount)
+    {
+        static_cast<AudioCapture*>(userdata)->Process(stream);
+    }
+
+    void AudioCapture::Process(SDL_AudioStream* stream)
+    {
+        const size_t channels = static_cast<size_t>(_spec.channels);
+        const int blockBytes = static_cast<int>(_scratch.size() * sizeof(float));
+        const float gain = _gain.load(std::memory_order_relaxed);
+
+        int received = 0;
+        while ((received = SDL_GetAudioStreamData(stream, _scratch.data(), blockBytes)) > 0)
+        {
+            const size_t samples = static_cast<size_t>(received) / sizeof(float);
+            const size_t frames = samples / channels;
+            if (gain != 1.0f)
+            {
+                for (size_t i = 0; i < samples; ++i)
+                {
+                    _scratch[i] *= gain;
+                }
+            }
+
+            _capturedFrames.fetch_add(frames, std::memory_order_relaxed);
+            DetectVoice(_scratch.data(), frames);
+            if (_settings.VoiceActivityDetection && _settings.GateOnVoice && !_voiceActive.load(std::memory_order_relaxed))
+            {
+                continue;
+            }
+
+            const size_t written = _ring.Write(_scratch.data(), samples);
+            if (written < samples)
+            {
+                _droppedFrames.fetch_add((samples - written) / channels, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void AudioCapture::DetectVoice(const float* samples, size_t frameCount)
+    {
+        const size_t sampleCount = frameCount * static_cast<size_t>(_spec.channels);
+        if (sampleCount == 0)
+        {
+            return;
+        }
+
+        const float meanSquare = Dsp::SumOfSquares(samples, sampleCount) / static_cast<float>(sampleCount);
+        const float levelDb = 10.0f * std::log10(std::max(meanSquare, 1e-10f));
+        _levelDb.store(levelDb, std::memory_order_relaxed);
+        if (!_settings.VoiceActivityDetection)
+        {
+            return;
+        }
+
+        // Hold activity through short pauses between words so the gate does not chatter.
+        _framesSinceVoice = levelDb >= _settings.VoiceThresholdDb ? 0 : _framesSinceVoice + frameCount;
+        _voiceActive.store(_framesSinceVoice <= _hangoverFrames, std::memory_order_relaxed);
+    }
+}
@@ -0,0 +1,82 @@
+#pragma once
+#include "SDL3AudioRingBuffer.h"
+#include <SDL3/SDL_audio.h>
+#include <atomic>
+#include <vector>
+
+namespace Tbx::Plugins::SDL3Audio
+{
+    struct CaptureSettings
+    {
+        int SampleRate = 48000;
+        int Channels = 1;
+        // Upper bound on how much audio may be buffered between the device and the reader.
+        // Older samples are dropped on read once it is exceeded.
+        float MaxLatencyMs = 100.0f;
+        float Gain = 1.0f;
+        bool VoiceActivityDetection = false;
+        float VoiceThresholdDb = -45.0f;
+        // How long voice activity is held after the level drops below the threshold.
+        float VoiceHangoverMs = 300.0f;
+        // With voice activity detection on, only blocks containing voice reach the reader.
+        bool GateOnVoice = false;
+    };
+
+    struct CaptureStats
+    {
+        Uint64 CapturedFrames = 0;
+        // Frames lost because the reader fell behind: dropped by the device callback when the
+        // ring was full, or trimmed on read to honour MaxLatencyMs.
+        Uint64 DroppedFrames = 0;
+        float BufferedMs = 0.0f;
+        float LevelDb = -100.0f;
+    };
+
+    // Records from the default recording device into a lock-free ring buffer. SDL delivers
+    // device audio on its own thread, where gain and voice detection are applied before the
+    // block is published; the game thread drains it with Read.
+    //
+    // To run without a microphone, start SDL with SDL_AUDIO_DRIVER=disk and point
+    // SDL_AUDIO_DISK_INPUT_FILE at a raw file in the device format.
+    class AudioCapture
+    {
+    public:
+        AudioCapture() = default;
+        ~AudioCapture();
+
+        AudioCapture(const AudioCapture&) = delete;
+        AudioCapture& operator=(const AudioCapture&) = delete;
+
+        bool Open(const CaptureSettings& settings);
+        void Close();
+        bool IsOpen() const;
+
+        // Reads up to frameCount interleaved float frames and returns how many were read.
+        size_t Read(float* frames, size_t frameCount);
+
+        void SetGain(float gain);
+        bool IsVoiceActive() const;
+        CaptureStats GetStats() const;
+        const SDL_AudioSpec& GetSpec() const;
+
+    private:
+        static void OnCaptured(void* userdata, SDL_AudioStream* stream, int additionalAmount, int totalAmount);
+        void Process(SDL_AudioStream* stream);
+        void DetectVoice(const float* samples, size_t frameCount);
+
+    private:
+        SDL_AudioStream* _stream = nullptr;
+        SDL_AudioSpec _spec = {};
+        CaptureSettings _settings = {};
+        AudioRingBuffer _ring = {};
+        std::vector<float> _scratch = {};
+        size_t _maxBufferedSamples = 0;
+        size_t _hangoverFrames = 0;
+        size_t _framesSinceVoice = 0;
+        std::atomic<float> _gain = 1.0f;
+        std::atomic<float> _levelDb = -100.0f;
+        std::atomic<bool> _voiceActive = false;
+        std::atomic<Uint64> _capturedFrames = 0;
+        std::atomic<Uint64> _droppedFrames = 0;
+    };
+}
@@ -0,0 +1,105 @@
+#pragma once
+#include <cmath>
+#include <cstddef>
+
+namespace Tbx::Plugins::SDL3Audio::Dsp
+{
+    // The helpers below keep several independent accumulators so the compiler can map
+    // reductions straight onto SIMD lanes without needing fast-math reassociation.
+
+    inline float DotProduct(const float* a, const float* b, size_t count)
+    {
+        float sum0 = 0.0f;
+        float sum1 = 0.0f;
+        float sum2 = 0.0f;
+        float sum3 = 0.0f;
+
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            sum0 += a[i] * b[i];
+            sum1 += a[i + 1] * b[i + 1];
+            sum2 += a[i + 2] * b[i + 2];
+            sum3 += a[i + 3] * b[i + 3];
+        }
+        for (; i < count; ++i)
+        {
+            sum0 += a[i] * b[i];
+        }
+
+        return (sum0 + sum1) + (sum2 + sum3);
+    }
+
+    inline float SumOfSquares(const float* samples, size_t count)
+    {
+        return DotProduct(samples, samples, count);
+    }
+
+    inline float PeakAbsolute(const float* samples, size_t count)
+    {
+        // Plain compares rather than std::fmax, whose NaN handling blocks vectorization.
+        float peak0 = 0.0f;
+        float peak1 = 0.0f;
+        float peak2 = 0.0f;
+        float peak3 = 0.0f;
+
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            const float a = std::fabs(samples[i]);
+            const float b = std::fabs(samples[i + 1]);
+            const float c = std::fabs(samples[i + 2]);
+            const float d = std::fabs(samples[i + 3]);
+            peak0 = a > peak0 ? a : peak0;
+            peak1 = b > peak1 ? b : peak1;
+            peak2 = c > peak2 ? c : peak2;
+            peak3 = d > peak3 ? d : peak3;
+        }
+        for (; i < count; ++i)
+        {
+            const float a = std::fabs(samples[i]);
+            peak0 = a > peak0 ? a : peak0;
+        }
+
+        const float low = peak0 > peak1 ? peak0 : peak1;
+        const float high = peak2 > peak3 ? peak2 : peak3;
+        return low > high ? low : high;
+    }
+
+    inline void Accumulate(float* destination, const float* source, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            destination[i] += source[i];
+        }
+    }
+
+    // Scales interleaved frames by a gain that moves linearly from one value to another,
+    // avoiding zipper noise when gains change between blocks.
+    inline void ApplyGainRamp(float* samples, size_t frameCount, size_t channels, float from, float to)
+    {
+        if (frameCount == 0)
+        {
+            return;
+        }
+
+        const float step = (to - from) / static_cast<float>(frameCount);
+        for (size_t frame = 0; frame < frameCount; ++frame)
+        {
+            const float gain = from + step * static_cast<float>(frame + 1);
+            for (size_t channel = 0; channel < channels; ++channel)
+            {
+                samples[frame * channels + channel] *= gain;
+            }
+        }
+    }
+
+    // Blends from one buffer into another. fadeIn holds the per-sample weight of 'to'.
+    inline void Crossfade(const float* from, const float* to, const float* fadeIn, float* output, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            output[i] = from[i] + fadeIn[i] * (to[i] - from[i]);
+        }
+    }
+}
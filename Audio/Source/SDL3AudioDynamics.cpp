@@ -0,0 +1,146 @@
+#include "SDL3AudioDynamics.h"
+#include "SDL3AudioDsp.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Tbx::Plugins::SDL3Audio
+{
+    static float DecibelsToGain(float decibels)
+    {
+        return std::pow(10.0f, decibels / 20.0f);
+    }
+
+    // One-pole smoothing coefficient for a time constant, updated once every 'interval' frames.
+    static float GetSmoothingCoefficient(float milliseconds, int sampleRate, size_t interval)
+    {
+        const float seconds = std::max(milliseconds, 0.01f) / 1000.0f;
+        const float step = static_cast<float>(interval) / static_cast<float>(std::max(sampleRate, 1));
+        return 1.0f - std::exp(-step / seconds);
+    }
+
+    void LookaheadLimiter::Configure(const LimiterSettings& settings, int sampleRate, int channels)
+    {
+        _channels = static_cast<size_t>(std::max(channels, 1));
+        _lookahead = std::max<size_t>(1, static_cast<size_t>(settings.LookaheadMs * static_cast<float>(sampleRate) / 1000.0f));
+        _ceiling = DecibelsToGain(std::min(settings.CeilingDb, 0.0f));
+        _releaseCoefficient = GetSmoothingCoefficient(settings.ReleaseMs, sampleRate, 1);
+
+        // The gain windows span lookahead + 1 frames so they include the frame leaving the
+        // delay line as well as the one entering it.
+        const size_t window = _lookahead + 1;
+        _delay.assign(_lookahead * _channels, 0.0f);
+        _holdValues.assign(window, 1.0f);
+        _holdIndices.assign(window, 0);
+        _averageWindow.assign(window, 1.0f);
+        _averageSum = static_cast<double>(window);
+        _holdHead = 0;
+        _holdCount = 0;
+        _position = 0;
+        _gain = 1.0f;
+    }
+
+    void LookaheadLimiter::Process(float* frames, size_t frameCount)
+    {
+        if (_delay.empty())
+        {
+            return;
+        }
+
+        const size_t window = _holdValues.size();
+        for (size_t frame = 0; frame < frameCount; ++frame)
+        {
+            float* samples = frames + frame * _channels;
+            const size_t slot = _position % _lookahead;
+            const size_t averageSlot = _position % window;
+
+            // Gain this frame needs to stay under the ceiling.
+            const float peak = Dsp::PeakAbsolute(samples, _channels);
+            const float required = peak > _ceiling ? _ceiling / peak : 1.0f;
+
+            // Sliding minimum over frames [position - lookahead, position], kept as a monotonic
+            // ring of (index, value) pairs so each frame costs amortized constant time. The
+            // expired front is dropped before pushing so the ring never holds more than the
+            // window.
+            if (_holdCount > 0 && _holdIndices[_holdHead] + window <= _position)
+            {
+                _holdHead = (_holdHead + 1) % window;
+                _holdCount--;
+            }
+            while (_holdCount > 0 && _holdValues[(_holdHead + _holdCount - 1) % window] >= required)
+            {
+                _holdCount--;
+            }
+            const size_t tail = (_holdHead + _holdCount) % window;
+            _holdValues[tail] = required;
+            _holdIndices[tail] = _position;
+            _holdCount++;
+            const float held = _holdValues[_holdHead];
+
+            // Moving average of the held minimum over the same window: every held value in it
+            // covers the frame leaving the delay line, so the average never exceeds that
+            // frame's required gain.
+            _averageSum += static_cast<double>(held) - static_cast<double>(_averageWindow[averageSlot]);
+            _averageWindow[averageSlot] = held;
+            const float smoothed = static_cast<float>(_averageSum / static_cast<double>(window));
+
+            // Attack follows the smoothed curve; release recovers exponentially.
+            _gain = smoothed < _gain ? smoothed : _gain + (smoothed - _gain) * _releaseCoefficient;
+
+            float* delayed = _delay.data() + slot * _channels;
+            for (size_t channel = 0; channel < _channels; ++channel)
+            {
+                const float input = samples[channel];
+                samples[channel] = delayed[channel] * _gain;
+                delayed[channel] = input;
+            }
+            _position++;
+        }
+    }
+
+    float LookaheadLimiter::GetGainReductionDb() const
+    {
+        return _gain < 1.0f ? -20.0f * std::log10(std::max(_gain, 1e-6f)) : 0.0f;
+    }
+
+    void BusDucker::Configure(const DuckingRule& rule, int sampleRate, int channels)
+    {
+        _rule = rule;
+        _rule.SidechainBus = std::clamp(rule.SidechainBus, 0, MaxAudioBuses - 1);
+        _rule.TargetBus = std::clamp(rule.TargetBus, 0, MaxAudioBuses - 1);
+        _rule.DepthDb = std::max(rule.DepthDb, 0.0f);
+        _channels = static_cast<size_t>(std::max(channels, 1));
+        _attackCoefficient = GetSmoothingCoefficient(rule.AttackMs, sampleRate, DetectionFrames);
+        _releaseCoefficient = GetSmoothingCoefficient(rule.ReleaseMs, sampleRate, DetectionFrames);
+        _envelope = 0.0f;
+        _gain = 1.0f;
+    }
+
+    void BusDucker::Process(const float* sidechain, float* target, size_t frameCount)
+    {
+        for (size_t start = 0; start < frameCount; start += DetectionFrames)
+        {
+            const size_t frames = std::min(DetectionFrames, frameCount - start);
+            const size_t samples = frames * _channels;
+            const float meanSquare = Dsp::SumOfSquares(sidechain + start * _channels, samples) / static_cast<float>(samples);
+
+            const float coefficient = meanSquare > _envelope ? _attackCoefficient : _releaseCoefficient;
+            _envelope += (meanSquare - _envelope) * coefficient;
+
+            const float levelDb = 10.0f * std::log10(std::max(_envelope, 1e-12f));
+            const float reductionDb = std::clamp(levelDb - _rule.ThresholdDb, 0.0f, _rule.DepthDb);
+            const float gain = DecibelsToGain(-reductionDb);
+            Dsp::ApplyGainRamp(target + start * _channels, frames, _channels, _gain, gain);
+            _gain = gain;
+        }
+    }
+
+    const DuckingRule& BusDucker::GetRule() const
+    {
+        return _rule;
+    }
+
+    float BusDucker::GetGain() const
+    {
+        return _gain;
+    }
+}
@@ -0,0 +1,79 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+
+namespace Tbx::Plugins::SDL3Audio
+{
+    // Voices are summed into one of these buses before the master stage. Bus 0 is the default.
+    inline constexpr int MaxAudioBuses = 8;
+
+    struct LimiterSettings
+    {
+        bool Enabled = true;
+        float CeilingDb = -1.0f;
+        // Also the latency the limiter adds to the master output.
+        float LookaheadMs = 5.0f;
+        float ReleaseMs = 100.0f;
+    };
+
+    // Attenuates TargetBus while SidechainBus is active, e.g. dialogue ducking music.
+    struct DuckingRule
+    {
+        int SidechainBus = 0;
+        int TargetBus = 0;
+        // Sidechain level above which ducking starts, in dBFS.
+        float ThresholdDb = -40.0f;
+        // Maximum attenuation applied to the target, in dB.
+        float DepthDb = 12.0f;
+        float AttackMs = 10.0f;
+        float ReleaseMs = 300.0f;
+    };
+
+    // Brickwall peak limiter. The input is delayed by the lookahead while a sliding minimum
+    // of the required gain is smoothed by a moving average. Both span lookahead + 1 frames,
+    // so gain is fully reduced by the time a peak leaves the delay line.
+    class LookaheadLimiter
+    {
+    public:
+        void Configure(const LimiterSettings& settings, int sampleRate, int channels);
+        void Process(float* frames, size_t frameCount);
+        float GetGainReductionDb() const;
+
+    private:
+        std::vector<float> _delay = {};
+        std::vector<float> _holdValues = {};
+        std::vector<size_t> _holdIndices = {};
+        std::vector<float> _averageWindow = {};
+        size_t _holdHead = 0;
+        size_t _holdCount = 0;
+        size_t _lookahead = 1;
+        size_t _position = 0;
+        size_t _channels = 0;
+        double _averageSum = 0.0;
+        float _ceiling = 1.0f;
+        float _releaseCoefficient = 0.0f;
+        float _gain = 1.0f;
+    };
+
+    // Applies one ducking rule. The sidechain is measured in short blocks with a vectorized
+    // energy pass and smoothed by an attack/release envelope; the resulting gain is ramped
+    // across each block of the target bus.
+    class BusDucker
+    {
+    public:
+        static constexpr size_t DetectionFrames = 32;
+
+        void Configure(const DuckingRule& rule, int sampleRate, int channels);
+        void Process(const float* sidechain, float* target, size_t frameCount);
+        const DuckingRule& GetRule() const;
+        float GetGain() const;
+
+    private:
+        DuckingRule _rule = {};
+        size_t _channels = 0;
+        float _attackCoefficient = 1.0f;
+        float _releaseCoefficient = 1.0f;
+        float _envelope = 0.0f;
+        float _gain = 1.0f;
+    };
+}
@@ -0,0 +1,183 @@
+#include "SDL3AudioLoudness.h"
+#include "SDL3AudioDsp.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numbers>
+#include <vector>
+
+namespace Tbx::Plugins::SDL3Audio
+{
+    // Transposed direct form II biquad. The K-weighting filter is recursive, so it runs per
+    // channel; the energy sums that follow it are the vectorized part.
+    struct Biquad
+    {
+        double B0 = 1.0, B1 = 0.0, B2 = 0.0;
+        double A1 = 0.0, A2 = 0.0;
+        double Z1 = 0.0, Z2 = 0.0;
+
+        float Process(float input)
+        {
+            const double x = input;
+            const double y = B0 * x + Z1;
+            Z1 = B1 * x - A1 * y + Z2;
+            Z2 = B2 * x - A2 * y;
+            return static_cast<float>(y);
+        }
+    };
+
+    // BS.1770 K-weighting (high shelf followed by the RLB high-pass), derived for any
+    // sample rate from the analog prototypes rather than the tabulated 48 kHz values.
+    static void BuildKWeighting(int sampleRate, Biquad& shelf, Biquad& highPass)
+    {
+        const double rate = static_cast<double>(std::max(sampleRate, 1));
+
+        double f0 = 1681.974450955533;
+        double gain = 3.999843853973347;
+        double q = 0.7071752369554196;
+        double k = std::tan(std::numbers::pi * f0 / rate);
+        const double vh = std::pow(10.0, gain / 20.0);
+        const double vb = std::pow(vh, 0.4996667741545416);
+        double a0 = 1.0 + k / q + k * k;
+        shelf.B0 = (vh + vb * k / q + k * k) / a0;
+        shelf.B1 = 2.0 * (k * k - vh) / a0;
+        shelf.B2 = (vh - vb * k / q + k * k) / a0;
+        shelf.A1 = 2.0 * (k * k - 1.0) / a0;
+        shelf.A2 = (1.0 - k / q + k * k) / a0;
+
+        f0 = 38.13547087602444;
+        q = 0.5003270373238773;
+        k = std::tan(std::numbers::pi * f0 / rate);
+        a0 = 1.0 + k / q + k * k;
+        highPass.B0 = 1.0;
+        highPass.B1 = -2.0;
+        highPass.B2 = 1.0;
+        highPass.A1 = 2.0 * (k * k - 1.0) / a0;
+        highPass.A2 = (1.0 - k / q + k * k) / a0;
+    }
+
+    // Surround channels are weighted up and the LFE is ignored, assuming SDL's channel order.
+    static float GetChannelWeight(size_t channel, size_t channelCount)
+    {
+        if (channelCount < 6 || channel < 3)
+        {
+            return 1.0f;
+        }
+        return channel == 3 ? 0.0f : 1.41f;
+    }
+
+    static double ToLufs(double meanSquare)
+    {
+        return meanSquare > 0.0 ? -0.691 + 10.0 * std::log10(meanSquare) : -std::numeric_limits<double>::infinity();
+    }
+
+    AudioLoudness AnalyzeLoudness(const float* samples, size_t frameCount, int channels, int sampleRate)
+    {
+        AudioLoudness loudness = {};
+        const size_t channelCount = static_cast<size_t>(std::max(channels, 1));
+        const size_t sampleCount = frameCount * channelCount;
+        if (samples == nullptr || sampleCount == 0)
+        {
+            return loudness;
+        }
+
+        // Peak and RMS are straight vectorized passes, chunked so the float partial sums stay
+        // precise on long assets.
+        constexpr size_t chunkSamples = 4096;
+        double sumOfSquares = 0.0;
+        for (size_t offset = 0; offset < sampleCount; offset += chunkSamples)
+        {
+            const size_t count = std::min(chunkSamples, sampleCount - offset);
+            loudness.Peak = std::max(loudness.Peak, Dsp::PeakAbsolute(samples + offset, count));
+            sumOfSquares += Dsp::SumOfSquares(samples + offset, count);
+        }
+        loudness.Rms = static_cast<float>(std::sqrt(sumOfSquares / static_cast<double>(sampleCount)));
+
+        // Gating blocks are 400 ms with 75% overlap, so measure weighted energy in 100 ms
+        // steps and sum four of them per block.
+        const size_t stepFrames = std::max<size_t>(static_cast<size_t>(sampleRate) / 10, 1);
+        std::vector<Biquad> shelves(channelCount);
+        std::vector<Biquad> highPasses(channelCount);
+        for (size_t channel = 0; channel < channelCount; ++channel)
+        {
+            BuildKWeighting(sampleRate, shelves[channel], highPasses[channel]);
+        }
+
+        std::vector<float> filtered(stepFrames);
+        std::vector<double> stepEnergy = {};
+        stepEnergy.reserve(frameCount / stepFrames + 1);
+        for (size_t start = 0; start < frameCount; start += stepFrames)
+        {
+            const size_t count = std::min(stepFrames, frameCount - start);
+            double energy = 0.0;
+            for (size_t channel = 0; channel < channelCount; ++channel)
+            {
+                const float weight = GetChannelWeight(channel, channelCount);
+                for (size_t frame = 0; frame < count; ++frame)
+                {
+                    const float sample = samples[(start + frame) * channelCount + channel];
+                    filtered[frame] = highPasses[channel].Process(shelves[channel].Process(sample));
+                }
+                energy += weight * Dsp::SumOfSquares(filtered.data(), count);
+            }
+            stepEnergy.push_back(energy);
+        }
+
+        std::vector<double> blocks = {};
+        const size_t blockFrames = stepFrames * 4;
+        if (frameCount < blockFrames)
+        {
+            double energy = 0.0;
+            for (const double step : stepEnergy)
+            {
+                energy += step;
+            }
+            blocks.push_back(energy / static_cast<double>(frameCount));
+        }
+        else
+        {
+            // A trailing partial step never completes a block, so it is left out.
+            const size_t completeSteps = frameCount / stepFrames;
+            for (size_t step = 3; step < completeSteps; ++step)
+            {
+                const double energy = stepEnergy[step - 3] + stepEnergy[step - 2] + stepEnergy[step - 1] + stepEnergy[step];
+                blocks.push_back(energy / static_cast<double>(blockFrames));
+            }
+        }
+
+        // Absolute gate at -70 LUFS, then a relative gate 10 LU below the absolute-gated mean.
+        double absoluteSum = 0.0;
+        size_t absoluteCount = 0;
+        for (const double block : blocks)
+        {
+            if (ToLufs(block) > SilentLoudness)
+            {
+                absoluteSum += block;
+                absoluteCount++;
+            }
+        }
+        if (absoluteCount == 0)
+        {
+            return loudness;
+        }
+
+        const double relativeGate = ToLufs(absoluteSum / static_cast<double>(absoluteCount)) - 10.0;
+        double gatedSum = 0.0;
+        size_t gatedCount = 0;
+        for (const double block : blocks)
+        {
+            const double blockLoudness = ToLufs(block);
+            if (blockLoudness > SilentLoudness && blockLoudness > relativeGate)
+            {
+                gatedSum += block;
+                gatedCount++;
+            }
+        }
+
+        if (gatedCount > 0)
+        {
+            loudness.IntegratedLufs = static_cast<float>(ToLufs(gatedSum / static_cast<double>(gatedCount)));
+        }
+        return loudness;
+    }
+}
@@ -0,0 +1,30 @@
+#pragma once
+#include <cstddef>
+
+namespace Tbx::Plugins::SDL3Audio
+{
+    enum class LoudnessAnalysisMode
+    {
+        Off,
+        // Analyze inside LoadAudio before the asset is returned.
+        Immediate,
+        // Return the asset straight away and analyze it on the audio worker thread.
+        Background
+    };
+
+    // Loudness floor reported for silent assets, matching the BS.1770 absolute gate.
+    inline constexpr float SilentLoudness = -70.0f;
+
+    struct AudioLoudness
+    {
+        // Linear sample peak and RMS across all channels.
+        float Peak = 0.0f;
+        float Rms = 0.0f;
+        // Gated integrated loudness per ITU-R BS.1770, in LUFS.
+        float IntegratedLufs = SilentLoudness;
+    };
+
+    // Analyzes interleaved float frames. Clips shorter than one 400 ms gating block are
+    // measured as a single block so short effects still get a usable loudness.
+    AudioLoudness AnalyzeLoudness(const float* samples, size_t frameCount, int channels, int sampleRate);
+}
@@ -0,0 +1,116 @@
+#include "SDL3AudioOutputTap.h"
+#include <algorithm>
+
+namespace Tbx::Plugins::SDL3Audio
+{
+    void OutputTap::Configure(const OutputTapSettings& settings, int sampleRate, int channels)
+    {
+        _settings = settings;
+        _channels = static_cast<size_t>(std::max(channels, 1));
+        _droppedSamples.store(0, std::memory_order_relaxed);
+        _framesSinceAnalysis = 0;
+        _historyWrite = 0;
+
+        if (!settings.Enabled)
+        {
+            _ring.Reset(0);
+            _history.clear();
+            _bands.clear();
+            return;
+        }
+
+        const float bufferedFrames = std::max(settings.BufferMs, 1.0f) * static_cast<float>(sampleRate) / 1000.0f;
+        _ring.Reset(static_cast<size_t>(bufferedFrames) * _channels, _channels);
+
+        if (!settings.Spectrum)
+        {
+            _history.clear();
+            _bands.clear();
+            return;
+        }
+
+        _analyzer.Configure(settings.FftSize, settings.BandCount, sampleRate);
+        _history.assign(_analyzer.GetSize(), 0.0f);
+        _analysisBlock.assign(_analyzer.GetSize(), 0.0f);
+        _bands.assign(_analyzer.GetBandCount(), -120.0f);
+        _analysisInterval = std::max<size_t>(1, static_cast<size_t>(static_cast<float>(sampleRate) / std::max(settings.SpectrumRateHz, 0.1f)));
+    }
+
+    void OutputTap::Process(const float* frames, size_t frameCount)
+    {
+        if (!_settings.Enabled)
+        {
+            return;
+        }
+
+        // Whatever does not fit is dropped rather than stalling the mix; the ring only accepts
+        // whole frames, so a block may be stored in part but never splits a frame.
+        const size_t samples = frameCount * _channels;
+        const size_t written = _ring.Write(frames, samples);
+        if (written < samples)
+        {
+            _droppedSamples.fetch_add(samples - written, std::memory_order_relaxed);
+        }
+
+        if (_history.empty())
+        {
+            return;
+        }
+
+        const float invChannels = 1.0f / static_cast<float>(_channels);
+        for (size_t frame = 0; frame < frameCount; ++frame)
+        {
+            float sum = 0.0f;
+            for (size_t channel = 0; channel < _channels; ++channel)
+            {
+                sum += frames[frame * _channels + channel];
+            }
+            _history[_historyWrite] = sum * invChannels;
+            _historyWrite = (_historyWrite + 1) % _history.size();
+        }
+
+        _framesSinceAnalysis += frameCount;
+        if (_framesSinceAnalysis >= _analysisInterval)
+        {
+            _framesSinceAnalysis = 0;
+            AnalyzeHistory();
+        }
+    }
+
+    AudioRingBuffer::Regions OutputTap::Peek() const
+    {
+        return _ring.Peek();
+    }
+
+    void OutputTap::Consume(size_t samples)
+    {
+        _ring.Discard(samples);
+    }
+
+    Uint64 OutputTap::GetDroppedSamples() const
+    {
+        return _droppedSamples.load(std::memory_order_relaxed);
+    }
+
+    size_t OutputTap::GetBands(std::span<float> bands) const
+    {
+        const size_t count = std::min(bands.size(), _bands.size());
+        std::copy_n(_bands.begin(), count, bands.begin());
+        return count;
+    }
+
+    const OutputTapSettings& OutputTap::GetSettings() const
+    {
+        return _settings;
+    }
+
+    void OutputTap::AnalyzeHistory()
+    {
+        // Unroll the circular history so the analyzer sees the newest window in order.
+        const size_t size = _history.size();
+        const size_t head = size - _historyWrite;
+        std::copy_n(_history.begin() + static_cast<std::ptrdiff_t>(_historyWrite), head, _analysisBlock.begin());
+        std::copy_n(_history.begin(), _historyWrite, _analysisBlock.begin() + static_cast<std::ptrdiff_t>(head));
+        _analyzer.Analyze(_analysisBlock.data(), _bands);
+    }
+}
@@ -0,0 +1,59 @@
+#pragma once
+#include "SDL3AudioRingBuffer.h"
+#include "SDL3AudioSpectrum.h"
+#include <SDL3/SDL_stdinc.h>
+#include <atomic>
+#include <span>
+#include <vector>
+
+namespace Tbx::Plugins::SDL3Audio
+{
+    struct OutputTapSettings
+    {
+        bool Enabled = false;
+        // How much of the final mix the tap holds before new blocks are dropped.
+        float BufferMs = 200.0f;
+        bool Spectrum = false;
+        size_t FftSize = 1024;
+        int BandCount = 16;
+        float SpectrumRateHz = 30.0f;
+    };
+
+    // Receives every mixed master block on the audio thread. The samples are published into
+    // a ring the game reads in place, and a mono mixdown feeds the spectrum analyzer at the
+    // configured rate.
+    class OutputTap
+    {
+    public:
+        // Not thread-safe; the caller keeps Process from running while reconfiguring.
+        void Configure(const OutputTapSettings& settings, int sampleRate, int channels);
+        void Process(const float* frames, size_t frameCount);
+
+        // Consumer side of the sample ring; see AudioRingBuffer::Peek.
+        AudioRingBuffer::Regions Peek() const;
+        void Consume(size_t samples);
+        Uint64 GetDroppedSamples() const;
+
+        // Copies the latest band energies and returns how many were written. Shares the
+        // threading rules of Configure.
+        size_t GetBands(std::span<float> bands) const;
+
+        const OutputTapSettings& GetSettings() const;
+
+    private:
+        void AnalyzeHistory();
+
+    private:
+        OutputTapSettings _settings = {};
+        size_t _channels = 0;
+        AudioRingBuffer _ring = {};
+        std::atomic<Uint64> _droppedSamples = 0;
+        SpectrumAnalyzer _analyzer = {};
+        std::vector<float> _history = {};
+        std::vector<float> _analysisBlock = {};
+        std::vector<float> _bands = {};
+        size_t _historyWrite = 0;
+        size_t _framesSinceAnalysis = 0;
+        size_t _analysisInterval = 0;
+    };
+}
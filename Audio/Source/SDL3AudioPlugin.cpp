@@ -1,8 +1,11 @@
 #include "SDL3AudioPlugin.h"
+#include "SDL3AudioDsp.h"
 #include "Tbx/Audio/Audio.h"
 #include "Tbx/Debug/Tracers.h"
 #include <SDL3/SDL_init.h>
+#include <SDL3/SDL_timer.h>
 #include <algorithm>
+#include <cstring>
 #include <cmath>
 #include <limits>
 #include <string>
@@ -43,6 +46,65 @@ namespace Tbx::Plugins::SDL3Audio
         return space;
     }
 
+    // Frames mixed per pass of RenderMix; bounds the size of every mix buffer.
+    static constexpr size_t MixBlockFrames = 512;
+
+    // Holds the master stream lock for a scope. RenderMix runs under the same lock, so the
+    // voice table and mix settings can be changed safely while it is held.
+    class MixLock
+    {
+    public:
+        explicit MixLock(SDL_AudioStream* stream)
+            : _stream(stream)
+        {
+            if (_stream)
+            {
+                SDL_LockAudioStream(_stream);
+            }
+        }
+
+        ~MixLock()
+        {
+            if (_stream)
+            {
+                SDL_UnlockAudioStream(_stream);
+            }
+        }
+
+        MixLock(const MixLock&) = delete;
+        MixLock& operator=(const MixLock&) = delete;
+
+    private:
+        SDL_AudioStream* _stream = nullptr;
+    };
+
+    static void PumpMasterStream(void* userdata, SDL_AudioStream* stream, int additionalAmount, int totalAmount)
+    {
+        static_cast<SDL3AudioPlugin*>(userdata)->RenderMix(stream, additionalAmount);
+    }
+
+    // Frames requested from a generator per call; sizes each procedural voice's scratch.
+    static constexpr size_t ProceduralBlockFrames = 512;
+
+    // Averages all channels into a mono signal duplicated onto both sides of a stereo buffer,
+    // which spatial playback then distributes with its channel map.
+    static void DownmixToStereo(const float* samples, size_t frameCount, int channels, float* stereo)
+    {
+        const float invChannelCount = 1.0f / static_cast<float>(channels);
+        for (size_t frame = 0; frame < frameCount; ++frame)
+        {
+            float monoSample = 0.0f;
+            const size_t baseIndex = frame * static_cast<size_t>(channels);
+            for (int channel = 0; channel < channels; ++channel)
+            {
+                monoSample += samples[baseIndex + static_cast<size_t>(channel)];
+            }
+            monoSample *= invChannelCount;
+            stereo[frame * 2] = monoSample;
+            stereo[frame * 2 + 1] = monoSample;
+        }
+    }
+
     static PlaybackParams BuildParamsFromInstance(const PlaybackInstance& instance)
     {
         PlaybackParams params = {};
@@ -57,6 +119,74 @@ namespace Tbx::Plugins::SDL3Audio
         return params;
     }
 
+    // Feeds a time-stretched voice whenever its stream runs low. SDL calls this on the audio
+    // thread with the stream locked, so it only renders into the voice's preallocated scratch.
+    static void PumpTimeStretchVoice(void* userdata, SDL_AudioStream* stream, int additionalAmount, int totalAmount)
+    {
+        auto* voice = static_cast<TimeStretchVoice*>(userdata);
+        const size_t channels = static_cast<size_t>(voice->Stretcher.GetChannels());
+        const size_t frameBytes = channels * sizeof(float);
+        const size_t scratchFrames = voice->Scratch.size() / channels;
+        if (additionalAmount <= 0 || scratchFrames == 0)
+        {
+            return;
+        }
+
+        const Uint64 start = SDL_GetPerformanceCounter();
+        size_t remaining = (static_cast<size_t>(additionalAmount) + frameBytes - 1) / frameBytes;
+        while (remaining > 0 && !voice->Stretcher.IsFinished())
+        {
+            const size_t rendered = voice->Stretcher.Render(voice->Scratch.data(), std::min(remaining, scratchFrames));
+            if (rendered == 0)
+            {
+                break;
+            }
+
+            SDL_PutAudioStreamData(stream, voice->Scratch.data(), static_cast<int>(rendered * frameBytes));
+            voice->ProcessedFrames += rendered;
+            remaining -= rendered;
+        }
+        voice->ProcessingTicks += SDL_GetPerformanceCounter() - start;
+    }
+
+    // Feeds a procedural voice from its generator whenever its stream runs low. Runs on the
+    // audio thread with the stream locked and only writes into preallocated buffers.
+    static void PumpProceduralVoice(void* userdata, SDL_AudioStream* stream, int additionalAmount, int totalAmount)
+    {
+        auto* voice = static_cast<ProceduralVoice*>(userdata);
+        const size_t outputChannels = voice->Downmix ? 2 : static_cast<size_t>(voice->Channels);
+        const size_t frameBytes = outputChannels * sizeof(float);
+        if (additionalAmount <= 0 || !voice->Generator)
+        {
+            return;
+        }
+
+        size_t remaining = (static_cast<size_t>(additionalAmount) + frameBytes - 1) / frameBytes;
+        while (remaining > 0 && !voice->Finished)
+        {
+            const size_t requested = std::min(remaining, ProceduralBlockFrames);
+            const size_t generated = std::min(voice->Generator(voice->Scratch.data(), requested, voice->Channels), requested);
+            if (generated < requested)
+            {
+                voice->Finished = true;
+            }
+            if (generated == 0)
+            {
+                break;
+            }
+
+            const float* block = voice->Scratch.data();
+            if (voice->Downmix)
+            {
+                DownmixToStereo(block, generated, voice->Channels, voice->Stereo.data());
+                block = voice->Stereo.data();
+            }
+
+            SDL_PutAudioStreamData(stream, block, static_cast<int>(generated * frameBytes));
+            remaining -= generated;
+        }
+    }
+
     SDL3AudioPlugin::SDL3AudioPlugin(Ref<EventBus> eventBus)
     {
         if (!SDL_InitSubSystem(SDL_INIT_AUDIO))
@@ -81,6 +211,24 @@ namespace Tbx::Plugins::SDL3Audio
             SDL_CloseAudioDevice(_device);
         }
 
+        _mixSpec.format = SDL_AUDIO_F32;
+        _mixSpec.channels = std::max(_deviceSpec.channels, 1);
+        _mixSpec.freq = _deviceSpec.freq > 0 ? _deviceSpec.freq : desired.freq;
+
+        const size_t blockSamples = MixBlockFrames * static_cast<size_t>(_mixSpec.channels);
+        _voiceBuffer.resize(blockSamples);
+        _busBuffers.resize(blockSamples * MaxAudioBuses);
+        _masterBuffer.resize(blockSamples);
+        _limiter.Configure(_limiterSettings, _mixSpec.freq, _mixSpec.channels);
+
+        _mixStream = SDL_CreateAudioStream(&_mixSpec, &_mixSpec);
+        if (_mixStream == nullptr
+            || !SDL_SetAudioStreamGetCallback(_mixStream, PumpMasterStream, this)
+            || !SDL_BindAudioStream(_device, _mixStream))
+        {
+            TBX_TRACE_ERROR("SDL3Audio: Failed to create the master mix stream: {}", SDL_GetError());
+        }
+
         if (!SDL_ResumeAudioDevice(_device))
         {
             TBX_TRACE_WARNING("SDL3Audio: Unable to resume audio device: {}", SDL_GetError());
@@ -93,6 +241,11 @@ namespace Tbx::Plugins::SDL3Audio
     SDL3AudioPlugin::~SDL3AudioPlugin()
     {
         SDL_PauseAudioDevice(_device);
+        _capture.Close();
+
+        // Destroying the master stream first guarantees RenderMix is no longer running.
+        SDL_DestroyAudioStream(_mixStream);
+        _mixStream = nullptr;
 
         for (auto& [_, playback] : _playbackInstances)
         {
@@ -125,7 +278,8 @@ namespace Tbx::Plugins::SDL3Audio
             return;
         }
 
-        SDL_PauseAudioStreamDevice(it->second.Stream);
+        MixLock lock(_mixStream);
+        it->second.Paused = true;
     }
 
     void SDL3AudioPlugin::Stop(const Audio& audio)
@@ -136,7 +290,10 @@ namespace Tbx::Plugins::SDL3Audio
             return;
         }
 
-        it->second.IsPlaying = false;
+        {
+            MixLock lock(_mixStream);
+            it->second.IsPlaying = false;
+        }
         RemovePlayback(audio, it->second);
     }
 
@@ -231,6 +388,325 @@ namespace Tbx::Plugins::SDL3Audio
         }
     }
 
+    void SDL3AudioPlugin::SetTimeStretchMode(const Audio& audio, TimeStretchMode mode)
+    {
+        _voiceSettings[audio.Id].TimeStretch = mode;
+
+        auto it = _playbackInstances.find(audio.Id);
+        if (it == _playbackInstances.end())
+        {
+            return;
+        }
+
+        PlaybackInstance& instance = it->second;
+        const bool stretching = instance.Stretch != nullptr;
+        if (instance.Procedural || stretching == (mode == TimeStretchMode::Wsola))
+        {
+            return;
+        }
+
+        // Stretched voices are pulled by a stream callback instead of queued up front, so the
+        // stream has to be rebuilt with the current spatial layout.
+        SpatialSettings spatial = {};
+        spatial.Requested = instance.Spatial;
+        spatial.Enabled = instance.Spatial;
+        spatial.Gain = instance.SpatialGain;
+        const PlaybackParams params = BuildParamsFromInstance(instance);
+        if (!BuildPlaybackStream(instance, audio, spatial) || !SetPlaybackParams(instance, audio, params))
+        {
+            RemovePlayback(audio, instance);
+        }
+    }
+
+    TimeStretchStats SDL3AudioPlugin::GetTimeStretchStats() const
+    {
+        TimeStretchStats stats = {};
+        const double ticksPerSecond = static_cast<double>(SDL_GetPerformanceFrequency());
+        double totalLoad = 0.0;
+        for (const auto& [_, instance] : _playbackInstances)
+        {
+            if (!instance.Stretch || !instance.Stream)
+            {
+                continue;
+            }
+
+            SDL_LockAudioStream(instance.Stream);
+            const Uint64 frames = instance.Stretch->ProcessedFrames;
+            const Uint64 ticks = instance.Stretch->ProcessingTicks;
+            SDL_UnlockAudioStream(instance.Stream);
+
+            stats.ActiveVoices++;
+            if (frames == 0 || instance.Stretch->SampleRate <= 0)
+            {
+                continue;
+            }
+
+            const double audioSeconds = static_cast<double>(frames) / static_cast<double>(instance.Stretch->SampleRate);
+            const double load = (static_cast<double>(ticks) / ticksPerSecond) / audioSeconds;
+            totalLoad += load;
+            stats.PeakVoiceLoad = std::max(stats.PeakVoiceLoad, load);
+        }
+
+        if (stats.ActiveVoices > 0)
+        {
+            stats.AverageVoiceLoad = totalLoad / static_cast<double>(stats.ActiveVoices);
+        }
+        return stats;
+    }
+
+    Ref<AudioBank> SDL3AudioPlugin::OpenAudioBank(const std::filesystem::path& filepath) const
+    {
+        return AudioBank::Open(filepath);
+    }
+
+    Ref<Audio> SDL3AudioPlugin::LoadBankedAudio(const Ref<AudioBank>& bank, std::string_view name) const
+    {
+        if (!bank)
+        {
+            return nullptr;
+        }
+
+        const AudioBankEntry* entry = bank->Find(name);
+        if (entry == nullptr)
+        {
+            TBX_TRACE_WARNING("SDL3Audio: Audio bank '{}' has no sound named '{}'.", bank->GetPath().string(), name);
+            return nullptr;
+        }
+
+        return MakeBankedAudio(bank, *entry);
+    }
+
+    Ref<Audio> SDL3AudioPlugin::LoadBankedAudio(const Ref<AudioBank>& bank, const Uid& id) const
+    {
+        if (!bank)
+        {
+            return nullptr;
+        }
+
+        const AudioBankEntry* entry = bank->Find(static_cast<Uint64>(id));
+        if (entry == nullptr)
+        {
+            TBX_TRACE_WARNING("SDL3Audio: Audio bank '{}' has no sound with id {}.", bank->GetPath().string(), id.ToString());
+            return nullptr;
+        }
+
+        return MakeBankedAudio(bank, *entry);
+    }
+
+    Ref<Audio> SDL3AudioPlugin::CreateProceduralAudio(const AudioFormat& format, AudioGenerator generator) const
+    {
+        if (!generator)
+        {
+            TBX_TRACE_WARNING("SDL3Audio: Procedural audio requires a generator.");
+            return nullptr;
+        }
+
+        if (format.SampleFormat != AudioSampleFormat::Float32 || format.Channels <= 0 || format.SampleRate <= 0)
+        {
+            TBX_TRACE_WARNING("SDL3Audio: Procedural audio requires a float32 format with a sample rate and channels.");
+            return nullptr;
+        }
+
+        auto audio = MakeRef<SDLAudio>(SampleData(), format);
+        audio->Generator = std::move(generator);
+        return audio;
+    }
+
+    void SDL3AudioPlugin::SetLoudnessAnalysisMode(LoudnessAnalysisMode mode)
+    {
+        _loudnessAnalysis = mode;
+    }
+
+    std::optional<AudioLoudness> SDL3AudioPlugin::GetLoudness(const Audio& audio) const
+    {
+        const auto* sdlAudio = dynamic_cast<const SDLAudio*>(&audio);
+        if (sdlAudio == nullptr || !sdlAudio->LoudnessReady.load(std::memory_order_acquire))
+        {
+            return std::nullopt;
+        }
+        return sdlAudio->Loudness;
+    }
+
+    void SDL3AudioPlugin::SetLoudnessNormalization(bool enabled, float targetLufs)
+    {
+        _normalizeLoudness = enabled;
+        _targetLoudness = targetLufs;
+    }
+
+    float SDL3AudioPlugin::GetAudibility(const Audio& audio) const
+    {
+        auto it = _playbackInstances.find(audio.Id);
+        if (it == _playbackInstances.end() || !it->second.IsPlaying)
+        {
+            return 0.0f;
+        }
+
+        const PlaybackInstance& instance = it->second;
+        const auto loudness = GetLoudness(audio);
+        float level = loudness ? loudness->Rms : 1.0f;
+        level *= instance.Volume * GetNormalizationGain(audio);
+        if (instance.Spatial)
+        {
+            level *= std::max(instance.SpatialGain.Left, instance.SpatialGain.Right);
+        }
+        return level;
+    }
+
+    void SDL3AudioPlugin::SetVoiceBus(const Audio& audio, int bus)
+    {
+        const int clamped = std::clamp(bus, 0, MaxAudioBuses - 1);
+        _voiceSettings[audio.Id].Bus = clamped;
+
+        auto it = _playbackInstances.find(audio.Id);
+        if (it != _playbackInstances.end())
+        {
+            MixLock lock(_mixStream);
+            it->second.Bus = clamped;
+        }
+    }
+
+    void SDL3AudioPlugin::SetMasterLimiter(const LimiterSettings& settings)
+    {
+        MixLock lock(_mixStream);
+        _limiterSettings = settings;
+        _limiter.Configure(_limiterSettings, _mixSpec.freq, _mixSpec.channels);
+    }
+
+    const LimiterSettings& SDL3AudioPlugin::GetMasterLimiter() const
+    {
+        return _limiterSettings;
+    }
+
+    float SDL3AudioPlugin::GetMasterGainReductionDb() const
+    {
+        MixLock lock(_mixStream);
+        return _limiterSettings.Enabled ? _limiter.GetGainReductionDb() : 0.0f;
+    }
+
+    void SDL3AudioPlugin::AddDuckingRule(const DuckingRule& rule)
+    {
+        BusDucker ducker = {};
+        ducker.Configure(rule, _mixSpec.freq, _mixSpec.channels);
+
+        MixLock lock(_mixStream);
+        _duckers.push_back(ducker);
+    }
+
+    void SDL3AudioPlugin::ClearDuckingRules()
+    {
+        MixLock lock(_mixStream);
+        _duckers.clear();
+    }
+
+    bool SDL3AudioPlugin::StartCapture(const CaptureSettings& settings)
+    {
+        return _capture.Open(settings);
+    }
+
+    void SDL3AudioPlugin::StopCapture()
+    {
+        _capture.Close();
+    }
+
+    size_t SDL3AudioPlugin::ReadCapture(float* frames, size_t frameCount)
+    {
+        return _capture.Read(frames, frameCount);
+    }
+
+    void SDL3AudioPlugin::SetCaptureGain(float gain)
+    {
+        _capture.SetGain(gain);
+    }
+
+    bool SDL3AudioPlugin::IsVoiceActive() const
+    {
+        return _capture.IsVoiceActive();
+    }
+
+    CaptureStats SDL3AudioPlugin::GetCaptureStats() const
+    {
+        return _capture.GetStats();
+    }
+
+    void SDL3AudioPlugin::SetOutputTap(const OutputTapSettings& settings)
+    {
+        MixLock lock(_mixStream);
+        _outputTap.Configure(settings, _mixSpec.freq, _mixSpec.channels);
+    }
+
+    AudioRingBuffer::Regions SDL3AudioPlugin::PeekOutputTap() const
+    {
+        return _outputTap.Peek();
+    }
+
+    void SDL3AudioPlugin::ConsumeOutputTap(size_t samples)
+    {
+        _outputTap.Consume(samples);
+    }
+
+    size_t SDL3AudioPlugin::GetSpectrumBands(std::span<float> bands) const
+    {
+        MixLock lock(_mixStream);
+        return _outputTap.GetBands(bands);
+    }
+
+    void SDL3AudioPlugin::RenderMix(SDL_AudioStream* stream, int additionalAmount)
+    {
+        const size_t channels = static_cast<size_t>(_mixSpec.channels);
+        const size_t frameBytes = channels * sizeof(float);
+        const size_t blockSamples = MixBlockFrames * channels;
+        size_t remaining = additionalAmount > 0 ? (static_cast<size_t>(additionalAmount) + frameBytes - 1) / frameBytes : 0;
+
+        while (remaining > 0)
+        {
+            const size_t frames = std::min(remaining, MixBlockFrames);
+            const size_t samples = frames * channels;
+            std::memset(_busBuffers.data(), 0, _busBuffers.size() * sizeof(float));
+
+            // Pull each voice through its own stream, which resamples and applies its gain.
+            for (auto& [_, instance] : _playbackInstances)
+            {
+                if (!instance.Stream || !instance.IsPlaying || instance.Paused)
+                {
+                    continue;
+                }
+
+                const int received = SDL_GetAudioStreamData(instance.Stream, _voiceBuffer.data(), static_cast<int>(samples * sizeof(float)));
+                if (received <= 0)
+                {
+                    continue;
+                }
+
+                float* bus = _busBuffers.data() + static_cast<size_t>(instance.Bus) * blockSamples;
+                Dsp::Accumulate(bus, _voiceBuffer.data(), static_cast<size_t>(received) / sizeof(float));
+            }
+
+            // Rules run in the order they were added, so a ducked bus can in turn duck another.
+            for (auto& ducker : _duckers)
+            {
+                const DuckingRule& rule = ducker.GetRule();
+                const float* sidechain = _busBuffers.data() + static_cast<size_t>(rule.SidechainBus) * blockSamples;
+                float* target = _busBuffers.data() + static_cast<size_t>(rule.TargetBus) * blockSamples;
+                ducker.Process(sidechain, target, frames);
+            }
+
+            std::memcpy(_masterBuffer.data(), _busBuffers.data(), samples * sizeof(float));
+            for (int bus = 1; bus < MaxAudioBuses; ++bus)
+            {
+                Dsp::Accumulate(_masterBuffer.data(), _busBuffers.data() + static_cast<size_t>(bus) * blockSamples, samples);
+            }
+
+            if (_limiterSettings.Enabled)
+            {
+                _limiter.Process(_masterBuffer.data(), frames);
+            }
+            _outputTap.Process(_masterBuffer.data(), frames);
+
+            SDL_PutAudioStreamData(stream, _masterBuffer.data(), static_cast<int>(samples * sizeof(float)));
+            remaining -= frames;
+        }
+    }
+
     bool SDL3AudioPlugin::CanLoadAudio(const std::filesystem::path& filepath) const
     {
         return IsSupportedExtension(filepath);
@@ -275,6 +751,19 @@ namespace Tbx::Plugins::SDL3Audio
         SDL_free(convertedBuffer);
         auto audio = MakeRef<SDLAudio>(samples, format);
         //audio->Owner = shared_from_this();
+
+        switch (_loudnessAnalysis)
+        {
+            case LoudnessAnalysisMode::Off:
+                break;
+            case LoudnessAnalysisMode::Immediate:
+                AnalyzeAudio(*audio);
+                break;
+            case LoudnessAnalysisMode::Background:
+                // The job holds a reference so the samples outlive the caller's handle.
+                _worker.Enqueue([audio]() { AnalyzeAudio(*audio); });
+                break;
+        }
         return audio;
     }
 
@@ -302,13 +791,24 @@ namespace Tbx::Plugins::SDL3Audio
             instance.SpatialGain = StereoSpace{};
         }
 
-        const float ratio = std::clamp(instance.Pitch * instance.Speed, 0.01f, 100.0f);
+        // Stretched voices leave tempo to the stretcher, so only pitch reaches the resampler.
+        const float resampleRate = instance.Stretch ? instance.Pitch : instance.Pitch * instance.Speed;
+        const float ratio = std::clamp(resampleRate, 0.01f, 100.0f);
         if (!SDL_SetAudioStreamFrequencyRatio(instance.Stream, ratio))
         {
             TBX_TRACE_WARNING("SDL3Audio: Failed to adjust audio stream playback ratio: {}", SDL_GetError());
         }
 
-        if (!SDL_SetAudioStreamGain(instance.Stream, instance.Volume))
+        if (instance.Stretch)
+        {
+            // The resampler already scales tempo by the pitch ratio, so compensate for it here.
+            SDL_LockAudioStream(instance.Stream);
+            instance.Stretch->Stretcher.SetTempo(instance.Speed / ratio);
+            instance.Stretch->Stretcher.SetLooping(instance.Loop);
+            SDL_UnlockAudioStream(instance.Stream);
+        }
+
+        if (!SDL_SetAudioStreamGain(instance.Stream, instance.Volume * GetNormalizationGain(audio)))
         {
             TBX_TRACE_WARNING("SDL3Audio: Failed to adjust audio stream volume: {}", SDL_GetError());
         }
@@ -327,6 +827,24 @@ namespace Tbx::Plugins::SDL3Audio
             }
         }
 
+        if (instance.Procedural)
+        {
+            // Generators run until they end themselves; looping restarts one that has.
+            SDL_LockAudioStream(instance.Stream);
+            const bool finished = instance.Procedural->Finished;
+            SDL_UnlockAudioStream(instance.Stream);
+            return instance.Loop && finished ? SubmitAudioData(instance, audio, false) : true;
+        }
+
+        if (instance.Loop && instance.Stretch)
+        {
+            // The stretcher wraps on its own; only a voice that already ran out needs a restart.
+            SDL_LockAudioStream(instance.Stream);
+            const bool finished = instance.Stretch->Stretcher.IsFinished();
+            SDL_UnlockAudioStream(instance.Stream);
+            return finished ? SubmitAudioData(instance, audio, false) : true;
+        }
+
         if (instance.Loop)
         {
             const int queued = SDL_GetAudioStreamQueued(instance.Stream);
@@ -433,6 +951,7 @@ namespace Tbx::Plugins::SDL3Audio
             return nullptr;
         }
 
+        MixLock lock(_mixStream);
         auto [iter, inserted] = _playbackInstances.try_emplace(audio.Id, std::move(instance));
         if (!inserted)
         {
@@ -447,7 +966,8 @@ namespace Tbx::Plugins::SDL3Audio
     {
         DestroyPlayback(instance);
 
-        if (audio.Format.SampleFormat == AudioSampleFormat::Unknown || audio.Data.empty())
+        const AudioGenerator* generator = GetGenerator(audio);
+        if (audio.Format.SampleFormat == AudioSampleFormat::Unknown || (generator == nullptr && GetSampleBytes(audio).empty()))
         {
             TBX_TRACE_WARNING("SDL3Audio: Audio asset {} contains no playable data.", audio.Id.ToString());
             return false;
@@ -466,38 +986,75 @@ namespace Tbx::Plugins::SDL3Audio
             sourceSpec.channels = 2;
         }
 
-        SDL_AudioStream* stream = SDL_CreateAudioStream(&sourceSpec, &_deviceSpec);
+        SDL_AudioStream* stream = SDL_CreateAudioStream(&sourceSpec, &_mixSpec);
         if (stream == nullptr)
         {
             TBX_TRACE_ERROR("SDL3Audio: Failed to create audio stream: {}", SDL_GetError());
             return false;
         }
 
-        if (!SDL_BindAudioStream(_device, stream))
+        if (generator != nullptr)
         {
-            TBX_TRACE_ERROR("SDL3Audio: Failed to bind audio stream: {}", SDL_GetError());
-            SDL_DestroyAudioStream(stream);
-            return false;
+            auto voice = std::make_unique<ProceduralVoice>();
+            voice->Generator = *generator;
+            voice->Channels = std::max(audio.Format.Channels, 1);
+            voice->Downmix = settings.Enabled;
+            voice->Scratch.resize(ProceduralBlockFrames * static_cast<size_t>(voice->Channels));
+            if (voice->Downmix)
+            {
+                voice->Stereo.resize(ProceduralBlockFrames * 2);
+            }
+
+            if (!SDL_SetAudioStreamGetCallback(stream, PumpProceduralVoice, voice.get()))
+            {
+                TBX_TRACE_ERROR("SDL3Audio: Failed to attach audio generator: {}", SDL_GetError());
+                SDL_DestroyAudioStream(stream);
+                return false;
+            }
+            instance.Procedural = std::move(voice);
+        }
+        else if (GetVoiceSettings(audio).TimeStretch == TimeStretchMode::Wsola)
+        {
+            if (sourceSpec.format != SDL_AUDIO_F32)
+            {
+                TBX_TRACE_WARNING("SDL3Audio: Time stretching requires float32 audio data for asset {}, falling back to resampling.", audio.Id.ToString());
+            }
+            else
+            {
+                auto voice = std::make_unique<TimeStretchVoice>();
+                voice->Scratch.resize(WsolaTimeStretcher::HopFrames * static_cast<size_t>(sourceSpec.channels));
+                voice->SampleRate = sourceSpec.freq;
+                if (SDL_SetAudioStreamGetCallback(stream, PumpTimeStretchVoice, voice.get()))
+                {
+                    instance.Stretch = std::move(voice);
+                }
+                else
+                {
+                    TBX_TRACE_WARNING("SDL3Audio: Failed to attach time stretcher, falling back to resampling: {}", SDL_GetError());
+                }
+            }
+        }
+
+        {
+            // The stream is unbound; RenderMix pulls it once it is in the voice table.
+            MixLock lock(_mixStream);
+            instance.Stream = stream;
+            instance.Bus = GetVoiceSettings(audio).Bus;
         }
 
-        instance.Stream = stream;
         if (settings.Enabled)
         {
             if (!ConfigureChannelMap(instance, settings.Gain))
             {
                 TBX_TRACE_ERROR("SDL3Audio: Failed to configure spatial channel map: {}", SDL_GetError());
-                SDL_UnbindAudioStream(stream);
-                SDL_DestroyAudioStream(stream);
-                instance.Stream = nullptr;
+                DestroyPlayback(instance);
                 return false;
             }
         }
 
         if (!SubmitAudioData(instance, audio, true))
         {
-            SDL_UnbindAudioStream(stream);
-            SDL_DestroyAudioStream(stream);
-            instance.Stream = nullptr;
+            DestroyPlayback(instance);
             return false;
         }
 
@@ -531,7 +1088,22 @@ namespace Tbx::Plugins::SDL3Audio
 
     bool SDL3AudioPlugin::SubmitAudioData(PlaybackInstance& instance, const Audio& audio, bool resetStream)
     {
-        if (!instance.Stream || audio.Data.empty())
+        if (instance.Stream && instance.Procedural)
+        {
+            // Nothing to queue; the generator is pulled by the stream callback.
+            if (resetStream && !SDL_ClearAudioStream(instance.Stream))
+            {
+                TBX_TRACE_WARNING("SDL3Audio: Failed to clear audio stream: {}", SDL_GetError());
+            }
+
+            SDL_LockAudioStream(instance.Stream);
+            instance.Procedural->Finished = false;
+            SDL_UnlockAudioStream(instance.Stream);
+            return true;
+        }
+
+        const std::span<const Uint8> sampleBytes = GetSampleBytes(audio);
+        if (!instance.Stream || sampleBytes.empty())
         {
             return false;
         }
@@ -546,6 +1118,18 @@ namespace Tbx::Plugins::SDL3Audio
 
         const auto queueRaw = [&](const void* buffer, size_t size) -> bool
         {
+            if (instance.Stretch)
+            {
+                // Stretched voices are pulled by the stream callback, so hand the samples to the
+                // stretcher instead of queueing them.
+                const int channels = instance.Spatial ? 2 : std::max(audio.Format.Channels, 1);
+                const size_t frameCount = size / (sizeof(float) * static_cast<size_t>(channels));
+                SDL_LockAudioStream(instance.Stream);
+                instance.Stretch->Stretcher.Reset(static_cast<const float*>(buffer), frameCount, channels, instance.Loop);
+                SDL_UnlockAudioStream(instance.Stream);
+                return true;
+            }
+
             if (size > static_cast<size_t>(std::numeric_limits<int>::max()))
             {
                 TBX_TRACE_ERROR("SDL3Audio: Audio asset {} is too large to queue for playback.", audio.Id.ToString());
@@ -568,10 +1152,10 @@ namespace Tbx::Plugins::SDL3Audio
             return true;
         };
 
-        const auto dataSize = audio.Data.size();
+        const auto dataSize = sampleBytes.size();
         if (!instance.Spatial)
         {
-            return queueRaw(audio.Data.data(), dataSize);
+            return queueRaw(sampleBytes.data(), dataSize);
         }
 
         if (audio.Format.SampleFormat != AudioSampleFormat::Float32)
@@ -596,23 +1180,7 @@ namespace Tbx::Plugins::SDL3Audio
 
         const size_t frameCount = sampleCount / static_cast<size_t>(channels);
         std::vector<float> processed(frameCount * 2);
-        const float invChannelCount = 1.0f / static_cast<float>(channels);
-        const float* samples = reinterpret_cast<const float*>(audio.Data.data());
-
-        for (size_t frame = 0; frame < frameCount; ++frame)
-        {
-            float monoSample = 0.0f;
-            const size_t baseIndex = frame * static_cast<size_t>(channels);
-            for (int channel = 0; channel < channels; ++channel)
-            {
-                // Average all channels to produce a single mono sample before handing it
-                // to the channel map for stereo distribution.
-                monoSample += samples[baseIndex + static_cast<size_t>(channel)];
-            }
-            monoSample *= invChannelCount;
-            processed[frame * 2] = monoSample;
-            processed[frame * 2 + 1] = monoSample;
-        }
+        DownmixToStereo(reinterpret_cast<const float*>(sampleBytes.data()), frameCount, channels, processed.data());
 
         return queueRaw(processed.data(), processed.size() * sizeof(float));
     }
@@ -631,17 +1199,22 @@ namespace Tbx::Plugins::SDL3Audio
             params.Stereo = spatial.Gain;
         }
 
-        instance->IsPlaying = true;
+        {
+            MixLock lock(_mixStream);
+            instance->IsPlaying = true;
+            instance->Paused = false;
+        }
         if (!SetPlaybackParams(*instance, audio, params))
         {
             RemovePlayback(audio, *instance);
         }
-        SDL_ResumeAudioStreamDevice(instance->Stream);
     }
 
     void SDL3AudioPlugin::RemovePlayback(const Audio& audio, PlaybackInstance& instance)
     {
         DestroyPlayback(instance);
+
+        MixLock lock(_mixStream);
         _playbackInstances.erase(audio.Id);
     }
 
@@ -652,10 +1225,89 @@ namespace Tbx::Plugins::SDL3Audio
             return;
         }
 
-        SDL_UnbindAudioStream(instance.Stream);
-        SDL_ClearAudioStream(instance.Stream);
-        SDL_DestroyAudioStream(instance.Stream);
-        instance.Stream = nullptr;
+        // Detach from the mix first so the audio thread never pulls a stream being destroyed.
+        SDL_AudioStream* stream = instance.Stream;
+        {
+            MixLock lock(_mixStream);
+            instance.Stream = nullptr;
+        }
+
+        SDL_ClearAudioStream(stream);
+        SDL_DestroyAudioStream(stream);
+        instance.Stretch.reset();
+        instance.Procedural.reset();
+    }
+
+    VoiceSettings SDL3AudioPlugin::GetVoiceSettings(const Audio& audio) const
+    {
+        auto it = _voiceSettings.find(audio.Id);
+        return it != _voiceSettings.end() ? it->second : VoiceSettings{};
+    }
+
+    float SDL3AudioPlugin::GetNormalizationGain(const Audio& audio) const
+    {
+        if (!_normalizeLoudness)
+        {
+            return 1.0f;
+        }
+
+        const auto loudness = GetLoudness(audio);
+        if (!loudness || loudness->IntegratedLufs <= SilentLoudness || loudness->Peak <= 0.0f)
+        {
+            return 1.0f;
+        }
+
+        const float gain = std::pow(10.0f, (_targetLoudness - loudness->IntegratedLufs) / 20.0f);
+        return std::min(gain, 1.0f / loudness->Peak);
+    }
+
+    Ref<Audio> SDL3AudioPlugin::MakeBankedAudio(const Ref<AudioBank>& bank, const AudioBankEntry& entry)
+    {
+        SDL_AudioSpec spec = {};
+        spec.format = static_cast<SDL_AudioFormat>(entry.Format);
+        spec.channels = entry.Channels;
+        spec.freq = entry.SampleRate;
+
+        auto audio = MakeRef<SDLAudio>(SampleData(), ConvertSpecToFormat(spec));
+        audio->Id = Uid(entry.Id);
+        audio->Bank = bank;
+        audio->MappedSamples = bank->GetSamples(entry);
+        return audio;
+    }
+
+    std::span<const Uint8> SDL3AudioPlugin::GetSampleBytes(const Audio& audio)
+    {
+        const auto* sdlAudio = dynamic_cast<const SDLAudio*>(&audio);
+        if (sdlAudio != nullptr && sdlAudio->Bank)
+        {
+            return sdlAudio->MappedSamples;
+        }
+        return { audio.Data.data(), audio.Data.size() };
+    }
+
+    const AudioGenerator* SDL3AudioPlugin::GetGenerator(const Audio& audio)
+    {
+        const auto* sdlAudio = dynamic_cast<const SDLAudio*>(&audio);
+        if (sdlAudio == nullptr || !sdlAudio->Generator)
+        {
+            return nullptr;
+        }
+        return &sdlAudio->Generator;
+    }
+
+    void SDL3AudioPlugin::AnalyzeAudio(SDLAudio& audio)
+    {
+        const std::span<const Uint8> sampleBytes = GetSampleBytes(audio);
+        if (audio.Format.SampleFormat != AudioSampleFormat::Float32 || sampleBytes.empty())
+        {
+            return;
+        }
+
+        const int channels = std::max(audio.Format.Channels, 1);
+        const size_t frameCount = sampleBytes.size() / (sizeof(float) * static_cast<size_t>(channels));
+        const auto* samples = reinterpret_cast<const float*>(sampleBytes.data());
+        audio.Loudness = AnalyzeLoudness(samples, frameCount, channels, audio.Format.SampleRate);
+        audio.LoudnessReady.store(true, std::memory_order_release);
     }
 
     bool SDL3AudioPlugin::IsSupportedExtension(const std::filesystem::path& path)
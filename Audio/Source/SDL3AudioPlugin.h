@@ -1,16 +1,47 @@
 #pragma once
+#include "SDL3AudioBank.h"
+#include "SDL3AudioCapture.h"
+#include "SDL3AudioDynamics.h"
+#include "SDL3AudioLoudness.h"
+#include "SDL3AudioOutputTap.h"
+#include "SDL3AudioTimeStretch.h"
+#include "SDL3AudioWorker.h"
 #include <Tbx/Audio/AudioMixer.h>
 #include <Tbx/Assets/AssetLoaders.h>
 #include <Tbx/Plugins/Plugin.h>
 #include <SDL3/SDL_audio.h>
+#include <atomic>
 #include <filesystem>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <span>
 #include <unordered_map>
+#include <vector>
 
 namespace Tbx::Plugins::SDL3Audio
 {
+    // Produces samples for a procedural voice on the audio thread. Writes up to frameCount
+    // interleaved float frames and returns how many were written; returning fewer ends the
+    // voice. It must not block, allocate or take locks.
+    using AudioGenerator = std::function<size_t(float* output, size_t frameCount, int channels)>;
+
     struct SDLAudio : public Audio, public IProductOfPluginFactory
     {
         using Audio::Audio;
+
+        // Set for assets served from a mapped bank. The samples stay in the mapping and the
+        // bank reference keeps it alive for as long as the asset exists.
+        Ref<AudioBank> Bank = nullptr;
+        std::span<const Uint8> MappedSamples = {};
+
+        // Written once by load-time analysis, possibly on the audio worker. Only read once
+        // LoudnessReady is set.
+        AudioLoudness Loudness = {};
+        std::atomic<bool> LoudnessReady = false;
+
+        // Set for procedural assets, which carry no sample data.
+        AudioGenerator Generator = nullptr;
     };
 
     struct StereoSpace
@@ -26,15 +57,59 @@ namespace Tbx::Plugins::SDL3Audio
         StereoSpace Gain = {};
     };
 
+    // Per-asset preferences that outlive individual playback streams.
+    struct VoiceSettings
+    {
+        TimeStretchMode TimeStretch = TimeStretchMode::Resample;
+        int Bus = 0;
+    };
+
+    // State for a voice whose stream is fed on demand by the time stretcher. The audio
+    // thread only touches it while SDL holds the stream lock.
+    struct TimeStretchVoice
+    {
+        WsolaTimeStretcher Stretcher = {};
+        std::vector<float> Scratch = {};
+        int SampleRate = 0;
+        Uint64 ProcessedFrames = 0;
+        Uint64 ProcessingTicks = 0;
+    };
+
+    // State for a voice whose stream is fed by an AudioGenerator. Like TimeStretchVoice, the
+    // audio thread only touches it while SDL holds the stream lock.
+    struct ProceduralVoice
+    {
+        AudioGenerator Generator = nullptr;
+        std::vector<float> Scratch = {};
+        // Spatial voices are mixed down to mono stereo, the same as sample voices.
+        std::vector<float> Stereo = {};
+        int Channels = 0;
+        bool Downmix = false;
+        bool Finished = false;
+    };
+
+    struct TimeStretchStats
+    {
+        int ActiveVoices = 0;
+        // Processing time divided by the duration of audio produced, i.e. the fraction of
+        // one core a single stretched voice costs.
+        double AverageVoiceLoad = 0.0;
+        double PeakVoiceLoad = 0.0;
+    };
+
     struct PlaybackInstance
     {
         SDL_AudioStream* Stream = nullptr;
+        std::unique_ptr<TimeStretchVoice> Stretch = nullptr;
+        std::unique_ptr<ProceduralVoice> Procedural = nullptr;
         float Pitch = 1.0f;
         float Speed = 1.0f;
         float Volume = 1.0f;
         bool Loop = false;
         bool IsPlaying = false;
+        bool Paused = false;
         bool Spatial = false;
+        int Bus = 0;
         StereoSpace SpatialGain = {};
     };
 
@@ -68,6 +143,64 @@ namespace Tbx::Plugins::SDL3Audio
 
         bool CanLoadAudio(const std::filesystem::path& filepath) const override;
 
+        // Selects how SetPlaybackSpeed is applied to the given asset. Switching an active
+        // voice rebuilds its stream and restarts it from the beginning.
+        void SetTimeStretchMode(const Audio& audio, TimeStretchMode mode);
+        TimeStretchStats GetTimeStretchStats() const;
+
+        // Banks are baked offline by SDL3AudioBankBaker. Assets loaded from a bank reference
+        // its mapped samples directly instead of copying them.
+        Ref<AudioBank> OpenAudioBank(const std::filesystem::path& filepath) const;
+        Ref<Audio> LoadBankedAudio(const Ref<AudioBank>& bank, std::string_view name) const;
+        Ref<Audio> LoadBankedAudio(const Ref<AudioBank>& bank, const Uid& id) const;
+
+        // Creates an asset whose voice is generated on the audio thread rather than read from
+        // samples. Only float32 formats are supported. Volume, pitch, speed and spatial
+        // controls behave as for sample voices; time stretching does not apply.
+        Ref<Audio> CreateProceduralAudio(const AudioFormat& format, AudioGenerator generator) const;
+
+        // Controls the peak/RMS/loudness pass LoadAudio runs on every asset.
+        void SetLoudnessAnalysisMode(LoudnessAnalysisMode mode);
+        std::optional<AudioLoudness> GetLoudness(const Audio& audio) const;
+
+        // When enabled, analyzed voices are gained towards the target integrated loudness,
+        // capped so their peak never exceeds full scale. Applies on the next parameter change.
+        void SetLoudnessNormalization(bool enabled, float targetLufs = -23.0f);
+
+        // Estimated output level of a voice: its RMS scaled by volume, normalization and
+        // spatial gain. Voices without analysis count as full-scale; stopped voices as zero.
+        float GetAudibility(const Audio& audio) const;
+
+        // Routes an asset's voice into one of the MaxAudioBuses mix buses. Buses are summed
+        // into the master, which is where the limiter runs.
+        void SetVoiceBus(const Audio& audio, int bus);
+        void SetMasterLimiter(const LimiterSettings& settings);
+        const LimiterSettings& GetMasterLimiter() const;
+        float GetMasterGainReductionDb() const;
+        void AddDuckingRule(const DuckingRule& rule);
+        void ClearDuckingRules();
+
+        // Microphone capture from the default recording device. Captured audio is read back
+        // as interleaved float frames in the format given by the settings.
+        bool StartCapture(const CaptureSettings& settings = {});
+        void StopCapture();
+        size_t ReadCapture(float* frames, size_t frameCount);
+        void SetCaptureGain(float gain);
+        bool IsVoiceActive() const;
+        CaptureStats GetCaptureStats() const;
+
+        // Opt-in tap on the final mix, after the limiter. PeekOutputTap exposes the tapped
+        // interleaved samples in place; pass the number processed to ConsumeOutputTap. Peeked
+        // regions are invalidated by the next SetOutputTap.
+        void SetOutputTap(const OutputTapSettings& settings);
+        AudioRingBuffer::Regions PeekOutputTap() const;
+        void ConsumeOutputTap(size_t samples);
+        // Copies the latest spectrum band energies and returns how many were written.
+        size_t GetSpectrumBands(std::span<float> bands) const;
+
+        // Called by the master stream on the audio thread to pull and mix every voice.
+        void RenderMix(SDL_AudioStream* stream, int additionalAmount);
+
     protected:
         Ref<Audio> LoadAudio(const std::filesystem::path& filepath) override;
 
@@ -80,10 +213,16 @@ namespace Tbx::Plugins::SDL3Audio
         void StartPlayback(const Audio& audio, const SpatialSettings& spatial);
         void RemovePlayback(const Audio& audio, PlaybackInstance& instance);
         void DestroyPlayback(PlaybackInstance& instance);
+        VoiceSettings GetVoiceSettings(const Audio& audio) const;
+        float GetNormalizationGain(const Audio& audio) const;
 
         SpatialSettings ResolveSpatialSettings(const Audio& audio) const;
         SpatialSettings ResolveSpatialSettings(const Audio& audio, const Vector3& position) const;
 
+        static Ref<Audio> MakeBankedAudio(const Ref<AudioBank>& bank, const AudioBankEntry& entry);
+        static std::span<const Uint8> GetSampleBytes(const Audio& audio);
+        static const AudioGenerator* GetGenerator(const Audio& audio);
+        static void AnalyzeAudio(SDLAudio& audio);
         static bool IsSupportedExtension(const std::filesystem::path& path);
         static AudioFormat ConvertSpecToFormat(const SDL_AudioSpec& spec);
         static SDL_AudioSpec ConvertFormatToSpec(const AudioFormat& format);
@@ -91,7 +230,24 @@ namespace Tbx::Plugins::SDL3Audio
     private:
         SDL_AudioDeviceID _device = 0;
         SDL_AudioSpec _deviceSpec = {};
+        // Voices are mixed by the plugin rather than the device so buses and the master can be
+        // processed. The master stream's lock guards everything RenderMix reads.
+        SDL_AudioSpec _mixSpec = {};
+        SDL_AudioStream* _mixStream = nullptr;
+        std::vector<float> _voiceBuffer = {};
+        std::vector<float> _busBuffers = {};
+        std::vector<float> _masterBuffer = {};
+        LimiterSettings _limiterSettings = {};
+        LookaheadLimiter _limiter = {};
+        std::vector<BusDucker> _duckers = {};
+        OutputTap _outputTap = {};
         std::unordered_map<Uid, PlaybackInstance> _playbackInstances = {};
+        std::unordered_map<Uid, VoiceSettings> _voiceSettings = {};
+        LoudnessAnalysisMode _loudnessAnalysis = LoudnessAnalysisMode::Background;
+        bool _normalizeLoudness = false;
+        float _targetLoudness = -23.0f;
+        AudioWorker _worker = {};
+        AudioCapture _capture = {};
     };
 
     TBX_REGISTER_PLUGIN(SDL3AudioPlugin);
@@ -0,0 +1,124 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace Tbx::Plugins::SDL3Audio
+{
+    // Single-producer, single-consumer ring of float samples. Write is only called from the
+    // producer thread and Read/Discard only from the consumer, so neither side ever blocks.
+    // Indices grow monotonically and are masked on access, which keeps full and empty
+    // distinguishable without wasting a slot. Counts are rounded down to whole frames so
+    // interleaved channels never get split across a partial write or read.
+    class AudioRingBuffer
+    {
+    public:
+        // Readable samples as they sit in the ring: the oldest run, then the wrapped remainder.
+        struct Regions
+        {
+            std::span<const float> First = {};
+            std::span<const float> Second = {};
+        };
+
+        // Rounds the capacity up to a power of two. Not thread-safe; only call while neither
+        // side is running.
+        void Reset(size_t minimumCapacity, size_t channels = 1)
+        {
+            _frameSize = std::max<size_t>(channels, 1);
+            size_t capacity = 1;
+            while (capacity < minimumCapacity)
+            {
+                capacity <<= 1;
+            }
+
+            _buffer.assign(capacity, 0.0f);
+            _mask = capacity - 1;
+            _writeIndex.store(0, std::memory_order_relaxed);
+            _readIndex.store(0, std::memory_order_relaxed);
+        }
+
+        // Copies as many whole frames as fit and returns how many samples were written.
+        size_t Write(const float* samples, size_t count)
+        {
+            const size_t write = _writeIndex.load(std::memory_order_relaxed);
+            const size_t read = _readIndex.load(std::memory_order_acquire);
+            count = ToWholeFrames(std::min(count, _buffer.size() - (write - read)));
+
+            const size_t offset = write & _mask;
+            const size_t first = std::min(count, _buffer.size() - offset);
+            std::copy_n(samples, first, _buffer.data() + offset);
+            std::copy_n(samples + first, count - first, _buffer.data());
+
+            _writeIndex.store(write + count, std::memory_order_release);
+            return count;
+        }
+
+        // Copies up to count of the oldest samples out, in whole frames, and returns how many
+        // were read.
+        size_t Read(float* samples, size_t count)
+        {
+            const size_t read = _readIndex.load(std::memory_order_relaxed);
+            const size_t write = _writeIndex.load(std::memory_order_acquire);
+            count = ToWholeFrames(std::min(count, write - read));
+
+            const size_t offset = read & _mask;
+            const size_t first = std::min(count, _buffer.size() - offset);
+            std::copy_n(_buffer.data() + offset, first, samples);
+            std::copy_n(_buffer.data(), count - first, samples + first);
+
+            _readIndex.store(read + count, std::memory_order_release);
+            return count;
+        }
+
+        // Drops up to count of the oldest samples, in whole frames, without copying them.
+        size_t Discard(size_t count)
+        {
+            const size_t read = _readIndex.load(std::memory_order_relaxed);
+            const size_t write = _writeIndex.load(std::memory_order_acquire);
+            count = ToWholeFrames(std::min(count, write - read));
+            _readIndex.store(read + count, std::memory_order_release);
+            return count;
+        }
+
+        // Exposes the readable samples without copying. Consumer only; the regions stay valid
+        // until they are released with Discard. Together they always hold whole frames, but a
+        // frame can straddle First and Second when the channel count is not a power of two.
+        Regions Peek() const
+        {
+            const size_t read = _readIndex.load(std::memory_order_relaxed);
+            const size_t count = _writeIndex.load(std::memory_order_acquire) - read;
+            const size_t offset = read & _mask;
+            const size_t first = std::min(count, _buffer.size() - offset);
+
+            Regions regions = {};
+            regions.First = { _buffer.data() + offset, first };
+            regions.Second = { _buffer.data(), count - first };
+            return regions;
+        }
+
+        size_t GetReadable() const
+        {
+            return _writeIndex.load(std::memory_order_acquire) - _readIndex.load(std::memory_order_acquire);
+        }
+
+        size_t GetCapacity() const
+        {
+            return _buffer.size();
+        }
+
+    private:
+        size_t ToWholeFrames(size_t count) const
+        {
+            return count - count % _frameSize;
+        }
+
+        std::vector<float> _buffer = {};
+        size_t _mask = 0;
+        size_t _frameSize = 1;
+        // Kept on separate cache lines so the producer and consumer do not contend.
+        alignas(64) std::atomic<size_t> _writeIndex = 0;
+        alignas(64) std::atomic<size_t> _readIndex = 0;
+    };
+}
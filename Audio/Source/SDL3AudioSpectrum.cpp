@@ -0,0 +1,138 @@
+#include "SDL3AudioSpectrum.h"
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+namespace Tbx::Plugins::SDL3Audio
+{
+    // Lowest band edge; anything below is mostly DC and window leakage.
+    static constexpr float LowestBandHz = 20.0f;
+
+    void SpectrumAnalyzer::Configure(size_t fftSize, int bandCount, int sampleRate)
+    {
+        _size = 16;
+        while (_size < fftSize)
+        {
+            _size <<= 1;
+        }
+
+        _window.resize(_size);
+        float windowEnergy = 0.0f;
+        for (size_t i = 0; i < _size; ++i)
+        {
+            _window[i] = 0.5f - 0.5f * std::cos(2.0f * std::numbers::pi_v<float> * static_cast<float>(i) / static_cast<float>(_size));
+            windowEnergy += _window[i] * _window[i];
+        }
+        // By Parseval, the positive-frequency bins of a windowed signal sum to about
+        // size * windowEnergy / 2 times its mean square.
+        _normalization = 2.0f / (static_cast<float>(_size) * windowEnergy);
+
+        _bitReverse.resize(_size);
+        size_t bits = 0;
+        while ((size_t{ 1 } << bits) < _size)
+        {
+            bits++;
+        }
+        for (size_t i = 0; i < _size; ++i)
+        {
+            size_t reversed = 0;
+            for (size_t bit = 0; bit < bits; ++bit)
+            {
+                reversed |= ((i >> bit) & 1) << (bits - 1 - bit);
+            }
+            _bitReverse[i] = reversed;
+        }
+
+        // The stage with half-length h keeps its h twiddles at offset h - 1.
+        _twiddleReal.resize(_size - 1);
+        _twiddleImag.resize(_size - 1);
+        for (size_t half = 1; half < _size; half <<= 1)
+        {
+            for (size_t k = 0; k < half; ++k)
+            {
+                const float angle = -std::numbers::pi_v<float> * static_cast<float>(k) / static_cast<float>(half);
+                _twiddleReal[half - 1 + k] = std::cos(angle);
+                _twiddleImag[half - 1 + k] = std::sin(angle);
+            }
+        }
+
+        _real.assign(_size, 0.0f);
+        _imag.assign(_size, 0.0f);
+
+        // Log-spaced bands from LowestBandHz to Nyquist, each at least one bin wide, so there
+        // are never more bands than bins.
+        const size_t bins = _size / 2;
+        const int count = std::clamp(bandCount, 1, static_cast<int>(bins));
+        const float binHz = static_cast<float>(std::max(sampleRate, 1)) / static_cast<float>(_size);
+        const float nyquist = binHz * static_cast<float>(bins);
+        const float low = std::min(LowestBandHz, nyquist * 0.5f);
+        _bandEdges.resize(static_cast<size_t>(count) + 1);
+        _bandEdges[0] = 1;
+        for (int band = 1; band <= count; ++band)
+        {
+            const float hz = low * std::pow(nyquist / low, static_cast<float>(band) / static_cast<float>(count));
+            const size_t edge = static_cast<size_t>(hz / binHz);
+            _bandEdges[static_cast<size_t>(band)] = std::min(std::max(edge, _bandEdges[static_cast<size_t>(band) - 1] + 1), bins + 1);
+        }
+    }
+
+    void SpectrumAnalyzer::Analyze(const float* samples, std::span<float> bands)
+    {
+        for (size_t i = 0; i < _size; ++i)
+        {
+            _real[_bitReverse[i]] = samples[i] * _window[i];
+        }
+        std::fill(_imag.begin(), _imag.end(), 0.0f);
+        Transform();
+
+        const size_t count = std::min(bands.size(), GetBandCount());
+        for (size_t band = 0; band < count; ++band)
+        {
+            const size_t first = std::min(_bandEdges[band], _size / 2);
+            const size_t last = std::min(_bandEdges[band + 1], _size / 2 + 1);
+            float energy = 0.0f;
+            for (size_t bin = first; bin < last; ++bin)
+            {
+                energy += _real[bin] * _real[bin] + _imag[bin] * _imag[bin];
+            }
+            bands[band] = 10.0f * std::log10(std::max(energy * _normalization, 1e-12f));
+        }
+    }
+
+    size_t SpectrumAnalyzer::GetSize() const
+    {
+        return _size;
+    }
+
+    size_t SpectrumAnalyzer::GetBandCount() const
+    {
+        return _bandEdges.empty() ? 0 : _bandEdges.size() - 1;
+    }
+
+    void SpectrumAnalyzer::Transform()
+    {
+        float* real = _real.data();
+        float* imag = _imag.data();
+        for (size_t half = 1; half < _size; half <<= 1)
+        {
+            const float* twiddleReal = _twiddleReal.data() + half - 1;
+            const float* twiddleImag = _twiddleImag.data() + half - 1;
+            for (size_t start = 0; start < _size; start += half * 2)
+            {
+                float* evenReal = real + start;
+                float* evenImag = imag + start;
+                float* oddReal = evenReal + half;
+                float* oddImag = evenImag + half;
+                for (size_t k = 0; k < half; ++k)
+                {
+                    const float productReal = oddReal[k] * twiddleReal[k] - oddImag[k] * twiddleImag[k];
+                    const float productImag = oddReal[k] * twiddleImag[k] + oddImag[k] * twiddleReal[k];
+                    oddReal[k] = evenReal[k] - productReal;
+                    oddImag[k] = evenImag[k] - productImag;
+                    evenReal[k] += productReal;
+                    evenImag[k] += productImag;
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,39 @@
+#pragma once
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace Tbx::Plugins::SDL3Audio
+{
+    // Hann-windowed radix-2 FFT that reduces a block of mono samples to log-spaced band
+    // energies. Real and imaginary parts live in separate arrays and each stage's twiddles
+    // are stored contiguously, so the butterfly loops vectorize.
+    class SpectrumAnalyzer
+    {
+    public:
+        // fftSize is rounded up to a power of two and bandCount is limited to one band per bin.
+        void Configure(size_t fftSize, int bandCount, int sampleRate);
+
+        // Analyzes GetSize() samples into GetBandCount() energies, in dB relative to the mean
+        // square of a full-scale signal.
+        void Analyze(const float* samples, std::span<float> bands);
+
+        size_t GetSize() const;
+        size_t GetBandCount() const;
+
+    private:
+        void Transform();
+
+    private:
+        size_t _size = 0;
+        float _normalization = 1.0f;
+        std::vector<float> _window = {};
+        std::vector<float> _real = {};
+        std::vector<float> _imag = {};
+        std::vector<float> _twiddleReal = {};
+        std::vector<float> _twiddleImag = {};
+        std::vector<size_t> _bitReverse = {};
+        // First bin of each band, plus one past the last bin of the final band.
+        std::vector<size_t> _bandEdges = {};
+    };
+}
@@ -0,0 +1,223 @@
+#include "SDL3AudioTimeStretch.h"
+#include "SDL3AudioDsp.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numbers>
+
+namespace Tbx::Plugins::SDL3Audio
+{
+    // Segments may start up to SearchFrames past the end of the source and read two hops
+    // from there, so the copied source is padded to keep every read contiguous.
+    static constexpr size_t PaddingFrames = WsolaTimeStretcher::SearchFrames + 2 * WsolaTimeStretcher::HopFrames;
+
+    void WsolaTimeStretcher::Reset(const float* frames, size_t frameCount, int channels, bool loop)
+    {
+        _channels = std::max(channels, 1);
+        _frameCount = frameCount;
+        _loop = loop;
+        _tempo = std::clamp(_tempo, MinTempo, MaxTempo);
+
+        const size_t channelCount = static_cast<size_t>(_channels);
+        const size_t paddedFrames = frameCount + PaddingFrames;
+        _frames.assign(paddedFrames * channelCount, 0.0f);
+        _mono.assign(paddedFrames, 0.0f);
+        if (frames != nullptr)
+        {
+            std::copy_n(frames, frameCount * channelCount, _frames.begin());
+        }
+
+        // Segment matching runs on a mono mixdown so its cost does not scale with channels.
+        const float invChannels = 1.0f / static_cast<float>(channelCount);
+        for (size_t frame = 0; frame < frameCount; ++frame)
+        {
+            float sum = 0.0f;
+            for (size_t channel = 0; channel < channelCount; ++channel)
+            {
+                sum += _frames[frame * channelCount + channel];
+            }
+            _mono[frame] = sum * invChannels;
+        }
+        FillPadding();
+
+        // Raised-cosine weights sum to one with their mirror, expanded per channel so the
+        // crossfade is a single flat loop.
+        _fadeIn.resize(HopFrames * channelCount);
+        for (size_t frame = 0; frame < HopFrames; ++frame)
+        {
+            const float phase = (static_cast<float>(frame) + 0.5f) / static_cast<float>(HopFrames);
+            const float weight = 0.5f - 0.5f * std::cos(std::numbers::pi_v<float> * phase);
+            for (size_t channel = 0; channel < channelCount; ++channel)
+            {
+                _fadeIn[frame * channelCount + channel] = weight;
+            }
+        }
+
+        _hop.assign(HopFrames * channelCount, 0.0f);
+        _hopRead = 0;
+        _hopFrames = 0;
+        _segmentStart = 0;
+        _analysisPosition = 0.0;
+        _primed = false;
+        _finished = frameCount == 0;
+    }
+
+    void WsolaTimeStretcher::SetTempo(float tempo)
+    {
+        _tempo = std::clamp(tempo, MinTempo, MaxTempo);
+    }
+
+    void WsolaTimeStretcher::SetLooping(bool loop)
+    {
+        if (_loop == loop)
+        {
+            return;
+        }
+
+        _loop = loop;
+        FillPadding();
+    }
+
+    size_t WsolaTimeStretcher::Render(float* output, size_t frameCount)
+    {
+        const size_t channelCount = static_cast<size_t>(_channels);
+        size_t written = 0;
+        while (written < frameCount)
+        {
+            if (_hopRead >= _hopFrames)
+            {
+                if (_finished)
+                {
+                    break;
+                }
+                ProcessHop();
+            }
+
+            const size_t count = std::min(frameCount - written, _hopFrames - _hopRead);
+            std::copy_n(_hop.data() + _hopRead * channelCount, count * channelCount, output + written * channelCount);
+            _hopRead += count;
+            written += count;
+        }
+
+        return written;
+    }
+
+    bool WsolaTimeStretcher::IsFinished() const
+    {
+        return _finished && _hopRead >= _hopFrames;
+    }
+
+    int WsolaTimeStretcher::GetChannels() const
+    {
+        return _channels;
+    }
+
+    void WsolaTimeStretcher::FillPadding()
+    {
+        // Looping sources mirror their start into the padding so segments can run across
+        // the loop point; one-shot sources fade into silence instead.
+        const size_t channelCount = static_cast<size_t>(_channels);
+        for (size_t pad = 0; pad < PaddingFrames; ++pad)
+        {
+            const size_t destination = _frameCount + pad;
+            if (_loop && _frameCount > 0)
+            {
+                const size_t source = pad % _frameCount;
+                std::copy_n(_frames.data() + source * channelCount, channelCount, _frames.data() + destination * channelCount);
+                _mono[destination] = _mono[source];
+            }
+            else
+            {
+                std::fill_n(_frames.data() + destination * channelCount, channelCount, 0.0f);
+                _mono[destination] = 0.0f;
+            }
+        }
+    }
+
+    void WsolaTimeStretcher::ProcessHop()
+    {
+        const size_t channelCount = static_cast<size_t>(_channels);
+        _hopRead = 0;
+        _hopFrames = HopFrames;
+
+        if (!_primed)
+        {
+            // The first hop is the head of the source, untouched.
+            std::copy_n(_frames.data(), HopFrames * channelCount, _hop.data());
+            _segmentStart = 0;
+            _primed = true;
+        }
+        else
+        {
+            const size_t reference = _segmentStart + HopFrames;
+            const float* tail = _frames.data() + reference * channelCount;
+            if (!_loop && _analysisPosition >= static_cast<double>(_frameCount))
+            {
+                // Fade the last segment out against the silent padding and stop.
+                Dsp::Crossfade(tail, _frames.data() + _frameCount * channelCount, _fadeIn.data(), _hop.data(), HopFrames * channelCount);
+                _finished = true;
+                return;
+            }
+
+            const size_t next = FindBestSegment(reference, _analysisPosition);
+            Dsp::Crossfade(tail, _frames.data() + next * channelCount, _fadeIn.data(), _hop.data(), HopFrames * channelCount);
+            _segmentStart = next;
+        }
+
+        _analysisPosition += static_cast<double>(HopFrames) * static_cast<double>(_tempo);
+        if (_loop && _frameCount > 0)
+        {
+            const double length = static_cast<double>(_frameCount);
+            _analysisPosition = std::fmod(_analysisPosition, length);
+            if (_segmentStart >= _frameCount)
+            {
+                // The padding mirrors the loop start, so the segment can be rebased in place.
+                _segmentStart -= _frameCount;
+            }
+        }
+    }
+
+    size_t WsolaTimeStretcher::FindBestSegment(size_t reference, double center) const
+    {
+        const double lowest = std::max(0.0, center - static_cast<double>(SearchFrames));
+        const double highest = std::min(center + static_cast<double>(SearchFrames), static_cast<double>(_frameCount + SearchFrames));
+        const size_t first = static_cast<size_t>(lowest);
+        const size_t last = std::max(first, static_cast<size_t>(highest));
+        const float* target = _mono.data() + reference;
+
+        // Coarse pass over the whole window, then refine around the winner.
+        size_t best = first;
+        float bestScore = std::numeric_limits<float>::lowest();
+        for (size_t candidate = first; candidate <= last; candidate += CoarseSearchStep)
+        {
+            const float score = ScoreSegment(target, candidate);
+            if (score > bestScore)
+            {
+                bestScore = score;
+                best = candidate;
+            }
+        }
+
+        const size_t refineFirst = best > first + CoarseSearchStep ? best - CoarseSearchStep + 1 : first;
+        const size_t refineLast = std::min(best + CoarseSearchStep - 1, last);
+        for (size_t candidate = refineFirst; candidate <= refineLast; ++candidate)
+        {
+            const float score = ScoreSegment(target, candidate);
+            if (score > bestScore)
+            {
+                bestScore = score;
+                best = candidate;
+            }
+        }
+
+        return best;
+    }
+
+    float WsolaTimeStretcher::ScoreSegment(const float* reference, size_t candidate) const
+    {
+        const float* samples = _mono.data() + candidate;
+        const float correlation = Dsp::DotProduct(reference, samples, CorrelationFrames);
+        const float energy = Dsp::SumOfSquares(samples, CorrelationFrames);
+        return correlation / std::sqrt(energy + 1e-9f);
+    }
+}
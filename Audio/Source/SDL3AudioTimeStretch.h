@@ -0,0 +1,63 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+
+namespace Tbx::Plugins::SDL3Audio
+{
+    enum class TimeStretchMode
+    {
+        // Speed is folded into the stream frequency ratio, so tempo and pitch move together.
+        Resample,
+        // Speed changes tempo only; pitch is left to the stream frequency ratio.
+        Wsola
+    };
+
+    // Waveform-similarity overlap-add time stretcher. Output is produced one hop at a time
+    // by crossfading the tail of the previous segment into the input segment that best
+    // matches it near the nominal read position. Every hop does a fixed amount of work, so
+    // the cost per voice is bounded regardless of tempo.
+    class WsolaTimeStretcher
+    {
+    public:
+        static constexpr size_t HopFrames = 512;
+        static constexpr size_t SearchFrames = 256;
+        static constexpr size_t CorrelationFrames = 256;
+        static constexpr size_t CoarseSearchStep = 4;
+        static constexpr float MinTempo = 0.25f;
+        static constexpr float MaxTempo = 4.0f;
+
+        // Copies the interleaved float frames so the source asset can be released while playing.
+        void Reset(const float* frames, size_t frameCount, int channels, bool loop);
+        void SetTempo(float tempo);
+        void SetLooping(bool loop);
+
+        // Renders up to frameCount interleaved frames and returns how many were written.
+        // Fewer frames than requested means a non-looping source has run out.
+        size_t Render(float* output, size_t frameCount);
+
+        bool IsFinished() const;
+        int GetChannels() const;
+
+    private:
+        void FillPadding();
+        void ProcessHop();
+        size_t FindBestSegment(size_t reference, double center) const;
+        float ScoreSegment(const float* reference, size_t candidate) const;
+
+    private:
+        std::vector<float> _frames = {};
+        std::vector<float> _mono = {};
+        std::vector<float> _fadeIn = {};
+        std::vector<float> _hop = {};
+        size_t _frameCount = 0;
+        size_t _hopRead = 0;
+        size_t _hopFrames = 0;
+        size_t _segmentStart = 0;
+        double _analysisPosition = 0.0;
+        float _tempo = 1.0f;
+        int _channels = 0;
+        bool _loop = false;
+        bool _primed = false;
+        bool _finished = true;
+    };
+}
@@ -0,0 +1,52 @@
+#include "SDL3AudioWorker.h"
+
+namespace Tbx::Plugins::SDL3Audio
+{
+    AudioWorker::~AudioWorker()
+    {
+        {
+            std::lock_guard lock(_mutex);
+            _stopping = true;
+        }
+        _wake.notify_all();
+
+        if (_thread.joinable())
+        {
+            _thread.join();
+        }
+    }
+
+    void AudioWorker::Enqueue(std::function<void()> job)
+    {
+        {
+            std::lock_guard lock(_mutex);
+            _jobs.push_back(std::move(job));
+            if (!_thread.joinable())
+            {
+                _thread = std::thread([this]() { Run(); });
+            }
+        }
+        _wake.notify_one();
+    }
+
+    void AudioWorker::Run()
+    {
+        while (true)
+        {
+            std::function<void()> job = {};
+            {
+                std::unique_lock lock(_mutex);
+                _wake.wait(lock, [this]() { return _stopping || !_jobs.empty(); });
+                if (_stopping)
+                {
+                    // Pending jobs are dropped; they only fill in optional asset data.
+                    return;
+                }
+
+                job = std::move(_jobs.front());
+                _jobs.pop_front();
+            }
+            job();
+        }
+    }
+}
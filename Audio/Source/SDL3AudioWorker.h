@@ -0,0 +1,33 @@
+#pragma once
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace Tbx::Plugins::SDL3Audio
+{
+    // Single background thread for audio work that should not stall loading or the game
+    // thread. The thread is started on the first job and joined on destruction.
+    class AudioWorker
+    {
+    public:
+        AudioWorker() = default;
+        ~AudioWorker();
+
+        AudioWorker(const AudioWorker&) = delete;
+        AudioWorker& operator=(const AudioWorker&) = delete;
+
+        void Enqueue(std::function<void()> job);
+
+    private:
+        void Run();
+
+    private:
+        std::thread _thread = {};
+        std::mutex _mutex = {};
+        std::condition_variable _wake = {};
+        std::deque<std::function<void()>> _jobs = {};
+        bool _stopping = false;
+    };
+}
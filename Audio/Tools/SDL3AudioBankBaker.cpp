@@ -0,0 +1,219 @@
+#include "SDL3AudioBankFormat.h"
+#include <SDL3/SDL_audio.h>
+#include <SDL3/SDL_error.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Offline tool that bakes .wav files into a single mmap-able bank for the SDL3 audio plugin.
+//
+// Usage: SDL3AudioBankBaker [--rate <hz>] <output.tbxbank> <file-or-directory>...
+//
+// Files are named by their stem; files found inside a directory are named by their path
+// relative to it, without extension, using forward slashes. Samples are stored as float32
+// at the requested rate (48000 Hz by default, matching the device the plugin opens), so
+// the runtime never has to convert them.
+
+using namespace Tbx::Plugins::SDL3Audio;
+
+namespace
+{
+    struct BankInput
+    {
+        std::string Name = {};
+        std::filesystem::path Path = {};
+    };
+
+    struct BakedSound
+    {
+        std::string Name = {};
+        Uint64 Id = 0;
+        SDL_AudioSpec Spec = {};
+        std::vector<Uint8> Samples = {};
+    };
+
+    bool IsWaveFile(const std::filesystem::path& path)
+    {
+        const auto extension = path.extension().string();
+        return extension == ".wav" || extension == ".wave";
+    }
+
+    void CollectInputs(const std::filesystem::path& input, std::vector<BankInput>& inputs)
+    {
+        if (!std::filesystem::is_directory(input))
+        {
+            inputs.push_back({ input.stem().generic_string(), input });
+            return;
+        }
+
+        for (const auto& item : std::filesystem::recursive_directory_iterator(input))
+        {
+            if (!item.is_regular_file() || !IsWaveFile(item.path()))
+            {
+                continue;
+            }
+
+            auto name = std::filesystem::relative(item.path(), input);
+            name.replace_extension();
+            inputs.push_back({ name.generic_string(), item.path() });
+        }
+    }
+
+    bool BakeSound(const BankInput& input, int sampleRate, BakedSound& sound)
+    {
+        SDL_AudioSpec sourceSpec = {};
+        Uint8* rawBuffer = nullptr;
+        Uint32 rawLength = 0;
+        if (!SDL_LoadWAV(input.Path.string().c_str(), &sourceSpec, &rawBuffer, &rawLength))
+        {
+            std::fprintf(stderr, "Failed to load '%s': %s\n", input.Path.string().c_str(), SDL_GetError());
+            return false;
+        }
+
+        SDL_AudioSpec targetSpec = sourceSpec;
+        targetSpec.format = SDL_AUDIO_F32;
+        targetSpec.freq = sampleRate > 0 ? sampleRate : sourceSpec.freq;
+
+        Uint8* convertedBuffer = nullptr;
+        int convertedLength = 0;
+        const bool converted = SDL_ConvertAudioSamples(&sourceSpec, rawBuffer, static_cast<int>(rawLength), &targetSpec, &convertedBuffer, &convertedLength);
+        SDL_free(rawBuffer);
+        if (!converted)
+        {
+            std::fprintf(stderr, "Failed to convert '%s': %s\n", input.Path.string().c_str(), SDL_GetError());
+            return false;
+        }
+
+        sound.Name = input.Name;
+        sound.Id = HashAudioBankName(input.Name);
+        sound.Spec = targetSpec;
+        sound.Samples.assign(convertedBuffer, convertedBuffer + convertedLength);
+        SDL_free(convertedBuffer);
+        return true;
+    }
+
+    bool WriteBank(const std::filesystem::path& output, const std::vector<BakedSound>& sounds)
+    {
+        // Keep the index at most half full so probe sequences stay short.
+        Uint32 slotCount = 1;
+        while (slotCount < sounds.size() * 2)
+        {
+            slotCount <<= 1;
+        }
+
+        AudioBankHeader header = {};
+        header.EntryCount = static_cast<Uint32>(sounds.size());
+        header.SlotCount = slotCount;
+        header.SlotsOffset = AlignAudioBankOffset(sizeof(AudioBankHeader));
+        header.EntriesOffset = AlignAudioBankOffset(header.SlotsOffset + slotCount * sizeof(Uint32));
+        header.NamesOffset = AlignAudioBankOffset(header.EntriesOffset + sounds.size() * sizeof(AudioBankEntry));
+
+        std::vector<AudioBankEntry> entries(sounds.size());
+        std::vector<Uint32> slots(slotCount, 0);
+        std::string names = {};
+        for (size_t i = 0; i < sounds.size(); ++i)
+        {
+            entries[i].Id = sounds[i].Id;
+            entries[i].NameOffset = static_cast<Uint32>(names.size());
+            entries[i].NameLength = static_cast<Uint32>(sounds[i].Name.size());
+            entries[i].SampleRate = sounds[i].Spec.freq;
+            entries[i].Channels = sounds[i].Spec.channels;
+            entries[i].Format = static_cast<Uint32>(sounds[i].Spec.format);
+            entries[i].DataSize = sounds[i].Samples.size();
+            names += sounds[i].Name;
+
+            Uint32 slot = static_cast<Uint32>(sounds[i].Id) & (slotCount - 1);
+            while (slots[slot] != 0)
+            {
+                slot = (slot + 1) & (slotCount - 1);
+            }
+            slots[slot] = static_cast<Uint32>(i + 1);
+        }
+
+        Uint64 offset = AlignAudioBankOffset(header.NamesOffset + names.size());
+        for (auto& entry : entries)
+        {
+            entry.DataOffset = offset;
+            offset = AlignAudioBankOffset(offset + entry.DataSize);
+        }
+        header.FileSize = offset;
+
+        std::vector<Uint8> bank(static_cast<size_t>(header.FileSize), 0);
+        std::memcpy(bank.data(), &header, sizeof(header));
+        std::memcpy(bank.data() + header.SlotsOffset, slots.data(), slots.size() * sizeof(Uint32));
+        std::memcpy(bank.data() + header.EntriesOffset, entries.data(), entries.size() * sizeof(AudioBankEntry));
+        std::memcpy(bank.data() + header.NamesOffset, names.data(), names.size());
+        for (size_t i = 0; i < sounds.size(); ++i)
+        {
+            std::memcpy(bank.data() + entries[i].DataOffset, sounds[i].Samples.data(), sounds[i].Samples.size());
+        }
+
+        std::ofstream file(output, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(bank.data()), static_cast<std::streamsize>(bank.size()));
+        return file.good();
+    }
+}
+
+int main(int argc, char** argv)
+{
+    int sampleRate = 48000;
+    std::filesystem::path output = {};
+    std::vector<BankInput> inputs = {};
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        if (arg == "--rate" && i + 1 < argc)
+        {
+            sampleRate = std::max(0, std::atoi(argv[++i]));
+        }
+        else if (output.empty())
+        {
+            output = arg;
+        }
+        else
+        {
+            CollectInputs(arg, inputs);
+        }
+    }
+
+    if (output.empty() || inputs.empty())
+    {
+        std::fprintf(stderr, "Usage: SDL3AudioBankBaker [--rate <hz>] <output%s> <file-or-directory>...\n", AudioBankExtension);
+        return 1;
+    }
+
+    std::vector<BakedSound> sounds = {};
+    std::unordered_map<Uint64, std::string> names = {};
+    for (const auto& input : inputs)
+    {
+        BakedSound sound = {};
+        if (!BakeSound(input, sampleRate, sound))
+        {
+            return 1;
+        }
+
+        // Ids are name hashes, so a collision would make one of the sounds unreachable.
+        auto [it, inserted] = names.try_emplace(sound.Id, sound.Name);
+        if (!inserted)
+        {
+            std::fprintf(stderr, "Sounds '%s' and '%s' share the same id.\n", it->second.c_str(), sound.Name.c_str());
+            return 1;
+        }
+        sounds.push_back(std::move(sound));
+    }
+
+    if (!WriteBank(output, sounds))
+    {
+        std::fprintf(stderr, "Failed to write '%s'.\n", output.string().c_str());
+        return 1;
+    }
+
+    std::printf("Baked %zu sounds into '%s'.\n", sounds.size(), output.string().c_str());
+    return 0;
+}
@@ -0,0 +1,151 @@
+#include "SDLFramePacer.h"
+#include <SDL3/SDL_timer.h>
+#include <algorithm>
+
+namespace Tbx::Plugins::SDLGraphicsContext
+{
+    void SDLFramePacer::Configure(const FramePacingSettings& settings)
+    {
+        _settings = settings;
+        _nextDeadline = 0;
+    }
+
+    const FramePacingSettings& SDLFramePacer::GetSettings() const
+    {
+        return _settings;
+    }
+
+    void SDLFramePacer::BeginFrame()
+    {
+        if (_settings.LateInputSampling && _nextDeadline != 0)
+        {
+            // Leave just enough time for the slowest recent frame before the deadline.
+            const Uint64 reserve = PredictWorkNs() + _settings.InputSafetyMarginNs;
+            if (_nextDeadline > reserve)
+            {
+                WaitUntil(_nextDeadline - reserve);
+            }
+        }
+        _frameBegin = SDL_GetTicksNS();
+    }
+
+    void SDLFramePacer::Pace(SDL_Window* window)
+    {
+        if (_pacedWindow == nullptr)
+        {
+            _pacedWindow = window;
+        }
+        if (window != _pacedWindow)
+        {
+            return;
+        }
+
+        if (_frameBegin != 0)
+        {
+            _workTimes[_workCount % WorkHistorySize] = SDL_GetTicksNS() - _frameBegin;
+            _workCount++;
+            _frameBegin = 0;
+        }
+
+        const Uint64 period = GetPeriodNs();
+        if (period != 0 && _nextDeadline != 0)
+        {
+            WaitUntil(_nextDeadline);
+        }
+
+        const Uint64 now = SDL_GetTicksNS();
+        if (_lastPresent != 0)
+        {
+            _frameTimes[_frameCount % HistorySize] = now - _lastPresent;
+            _frameCount++;
+        }
+        _lastPresent = now;
+
+        // Deadlines advance by whole periods so the cadence does not drift. After a frame
+        // that missed by more than a period, the schedule restarts from now instead of
+        // rushing the following frames to catch up.
+        if (period == 0)
+        {
+            _nextDeadline = 0;
+        }
+        else if (_nextDeadline == 0 || now > _nextDeadline + period)
+        {
+            _nextDeadline = now + period;
+        }
+        else
+        {
+            _nextDeadline += period;
+        }
+    }
+
+    void SDLFramePacer::Forget(SDL_Window* window)
+    {
+        if (_pacedWindow == window)
+        {
+            _pacedWindow = nullptr;
+        }
+    }
+
+    FrameTimeStats SDLFramePacer::GetStats() const
+    {
+        FrameTimeStats stats = {};
+        stats.FrameCount = _frameCount;
+
+        const size_t count = static_cast<size_t>(std::min<Uint64>(_frameCount, HistorySize));
+        if (count == 0)
+        {
+            return stats;
+        }
+
+        std::array<Uint64, HistorySize> sorted = _frameTimes;
+        std::sort(sorted.begin(), sorted.begin() + count);
+
+        Uint64 sum = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            sum += sorted[i];
+        }
+
+        constexpr double nsPerMs = 1000000.0;
+        const auto percentile = [&](double p) { return static_cast<double>(sorted[static_cast<size_t>(p * static_cast<double>(count - 1))]) / nsPerMs; };
+        stats.AverageMs = static_cast<double>(sum) / static_cast<double>(count) / nsPerMs;
+        stats.P95Ms = percentile(0.95);
+        stats.P99Ms = percentile(0.99);
+        stats.MaxMs = static_cast<double>(sorted[count - 1]) / nsPerMs;
+        return stats;
+    }
+
+    void SDLFramePacer::WaitUntil(Uint64 deadlineNs) const
+    {
+        const Uint64 now = SDL_GetTicksNS();
+        if (now + _settings.SpinThresholdNs < deadlineNs)
+        {
+            SDL_DelayNS(deadlineNs - now - _settings.SpinThresholdNs);
+        }
+
+        while (SDL_GetTicksNS() < deadlineNs)
+        {
+        }
+    }
+
+    Uint64 SDLFramePacer::GetPeriodNs() const
+    {
+        if (_settings.TargetFps <= 0.0)
+        {
+            return 0;
+        }
+        return static_cast<Uint64>(1000000000.0 / _settings.TargetFps);
+    }
+
+    Uint64 SDLFramePacer::PredictWorkNs() const
+    {
+        // The slowest of the recent frames: conservative, and cheap enough to do every frame.
+        const size_t count = static_cast<size_t>(std::min<Uint64>(_workCount, WorkHistorySize));
+        Uint64 slowest = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            slowest = std::max(slowest, _workTimes[i]);
+        }
+        return slowest;
+    }
+}
@@ -0,0 +1,70 @@
+#pragma once
+#include <SDL3/SDL_stdinc.h>
+#include <SDL3/SDL_video.h>
+#include <array>
+
+namespace Tbx::Plugins::SDLGraphicsContext
+{
+    struct FramePacingSettings
+    {
+        // Zero leaves the frame rate to vsync.
+        double TargetFps = 0.0;
+        // Waits sleep until this close to the deadline, then spin, since OS sleeps can
+        // overshoot by around a millisecond.
+        Uint64 SpinThresholdNs = 1500000;
+        // Moves the limiter's wait from before Present to BeginFrame, so input is sampled
+        // as late as the recent frame work times allow.
+        bool LateInputSampling = false;
+        // Slack kept between the predicted end of the frame's work and its deadline.
+        Uint64 InputSafetyMarginNs = 1000000;
+    };
+
+    struct FrameTimeStats
+    {
+        Uint64 FrameCount = 0;
+        double AverageMs = 0.0;
+        double P95Ms = 0.0;
+        double P99Ms = 0.0;
+        double MaxMs = 0.0;
+    };
+
+    // Paces presents to a target frame rate with a hybrid sleep/spin wait and keeps recent
+    // frame times. Only one window is paced, the first to present, so rendering several
+    // windows a frame waits once.
+    class SDLFramePacer
+    {
+    public:
+        void Configure(const FramePacingSettings& settings);
+        const FramePacingSettings& GetSettings() const;
+
+        // Marks the start of a frame. Call it right before sampling input; with late input
+        // sampling it first waits out the part of the frame the work will not need.
+        void BeginFrame();
+        // Called by graphics contexts right before swapping.
+        void Pace(SDL_Window* window);
+        void Forget(SDL_Window* window);
+
+        // Over the last HistorySize frames.
+        FrameTimeStats GetStats() const;
+
+    private:
+        void WaitUntil(Uint64 deadlineNs) const;
+        Uint64 GetPeriodNs() const;
+        Uint64 PredictWorkNs() const;
+
+    private:
+        static constexpr size_t HistorySize = 256;
+        static constexpr size_t WorkHistorySize = 32;
+
+        FramePacingSettings _settings = {};
+        SDL_Window* _pacedWindow = nullptr;
+        Uint64 _nextDeadline = 0;
+        Uint64 _lastPresent = 0;
+        Uint64 _frameBegin = 0;
+
+        std::array<Uint64, HistorySize> _frameTimes = {};
+        Uint64 _frameCount = 0;
+        std::array<Uint64, WorkHistorySize> _workTimes = {};
+        Uint64 _workCount = 0;
+    };
+}
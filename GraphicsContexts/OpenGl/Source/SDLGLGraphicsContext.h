@@ -1,6 +1,8 @@
 #pragma once
 #include "Tbx/Graphics/GraphicsContext.h"
 #include "Tbx/Plugins/Plugin.h"
+#include "SDLFramePacer.h"
+#include "SDLGLSharedContext.h"
 #include <SDL3/SDL_video.h>
 
 namespace Tbx::Plugins::SDLGraphicsContext
@@ -8,7 +10,7 @@ namespace Tbx::Plugins::SDLGraphicsContext
     class SDLGLGraphicsContext final : public IGraphicsContext, public IProductOfPluginFactory
     {
     public:
-        SDLGLGraphicsContext(SDL_Window* window);
+        SDLGLGraphicsContext(SDL_Window* window, Ref<SDLGLSharedContext> sharedContext, Ref<SDLFramePacer> pacer);
         ~SDLGLGraphicsContext();
 
         void MakeCurrent() override;
@@ -19,7 +21,9 @@ namespace Tbx::Plugins::SDLGraphicsContext
 
     private:
         SDL_Window* _window = nullptr;
-        SDL_GLContext _glContext = nullptr;
+        // Every window renders through the provider's one context.
+        Ref<SDLGLSharedContext> _sharedContext = nullptr;
+        Ref<SDLFramePacer> _pacer = nullptr;
     };
 }
 
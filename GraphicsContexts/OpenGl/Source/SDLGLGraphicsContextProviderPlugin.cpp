@@ -1,4 +1,5 @@
 #include "Tbx/Debug/Asserts.h"
+#include "Tbx/Debug/Tracers.h"
 #include "SDLGLGraphicsContextProviderPlugin.h"
 #include "SDLGLGraphicsContext.h"
 
@@ -12,7 +13,35 @@ namespace Tbx::Plugins::SDLGraphicsContext
             return nullptr;
         }
         auto* sdlWindow = std::any_cast<SDL_Window*>(window->GetNativeWindow());
-        return Create(sdlWindow);
+
+        // Windows created without GL support, such as on the headless dummy driver, cannot
+        // host a context.
+        if ((SDL_GetWindowFlags(sdlWindow) & SDL_WINDOW_OPENGL) == 0)
+        {
+            TBX_TRACE_WARNING("SDL OpenGL Graphics Context Provider: Window was not created with OpenGL support, no context provided.");
+            return nullptr;
+        }
+        return Create(sdlWindow, _sharedContext, _pacer);
+    }
+
+    void SDLOpenGlGraphicsContextsProviderPlugin::SetFramePacing(const FramePacingSettings& settings)
+    {
+        _pacer->Configure(settings);
+    }
+
+    const FramePacingSettings& SDLOpenGlGraphicsContextsProviderPlugin::GetFramePacing() const
+    {
+        return _pacer->GetSettings();
+    }
+
+    void SDLOpenGlGraphicsContextsProviderPlugin::BeginFrame()
+    {
+        _pacer->BeginFrame();
+    }
+
+    FrameTimeStats SDLOpenGlGraphicsContextsProviderPlugin::GetFrameTimeStats() const
+    {
+        return _pacer->GetStats();
     }
 
     GraphicsApi SDLOpenGlGraphicsContextsProviderPlugin::GetApi() const
@@ -14,6 +14,18 @@ namespace Tbx::Plugins::SDLGraphicsContext
         SDLOpenGlGraphicsContextsProviderPlugin(Ref<EventBus> eventBus) {}
         GraphicsApi GetApi() const override;
         Ref<IGraphicsContext> Provide(const Window* window) override;
+
+        // Frame limiting and timing for every context this provider creates. Call
+        // BeginFrame right before sampling input each frame; it is required for late input
+        // sampling and for the work-time prediction behind it.
+        void SetFramePacing(const FramePacingSettings& settings);
+        const FramePacingSettings& GetFramePacing() const;
+        void BeginFrame();
+        FrameTimeStats GetFrameTimeStats() const;
+
+    private:
+        Ref<SDLGLSharedContext> _sharedContext = std::make_shared<SDLGLSharedContext>();
+        Ref<SDLFramePacer> _pacer = std::make_shared<SDLFramePacer>();
     };
 
     TBX_REGISTER_PLUGIN(SDLOpenGlGraphicsContextsProviderPlugin);
@@ -0,0 +1,71 @@
+#include "SDLGLSharedContext.h"
+#include "Tbx/Debug/Asserts.h"
+#include <glad/glad.h>
+#include <SDL3/SDL_hints.h>
+
+namespace Tbx::Plugins::SDLGraphicsContext
+{
+    SDLGLSharedContext::~SDLGLSharedContext()
+    {
+        if (_context != nullptr)
+        {
+            SDL_GL_DestroyContext(_context);
+            _context = nullptr;
+        }
+    }
+
+    bool SDLGLSharedContext::Attach(SDL_Window* window)
+    {
+        if (_context != nullptr)
+        {
+            return true;
+        }
+
+        // Set attribute
+        SDL_SetHint(SDL_HINT_RENDER_DRIVER, "opengl");
+        SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 4);
+        SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 5);
+        SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_CORE);
+#ifdef TBX_DEBUG
+        SDL_GL_SetAttribute(SDL_GL_CONTEXT_FLAGS, SDL_GL_CONTEXT_DEBUG_FLAG);
+#endif
+        // Validate attributes
+        int att = 0;
+        SDL_GL_GetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, &att);
+        TBX_ASSERT(att == 4, "SDLGLContext: Failed to set OpenGL context major version to 4");
+        SDL_GL_GetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, &att);
+        TBX_ASSERT(att == 5, "SDLGLContext: Failed to set OpenGL context minor version to 5");
+        SDL_GL_GetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, &att);
+        TBX_ASSERT(att == SDL_GL_CONTEXT_PROFILE_CORE, "SDLGLContext: Failed to set OpenGL context profile to core");
+#ifdef TBX_DEBUG
+        SDL_GL_GetAttribute(SDL_GL_CONTEXT_FLAGS, &att);
+        TBX_ASSERT(att == SDL_GL_CONTEXT_DEBUG_FLAG, "SDLGLContext: Failed to set OpenGL context debug flag");
+#endif
+
+        _context = SDL_GL_CreateContext(window);
+        TBX_ASSERT(_context, "SDLGLContext: Failed to create gl context for window!");
+        if (_context == nullptr)
+        {
+            return false;
+        }
+
+        int gladStatus = gladLoadGLLoader((GLADloadproc)SDL_GL_GetProcAddress);
+        TBX_ASSERT(gladStatus, "GL Rendering: Failed to initialize Glad!");
+        return true;
+    }
+
+    void SDLGLSharedContext::MakeCurrent(SDL_Window* window)
+    {
+        if (_context == nullptr)
+        {
+            return;
+        }
+
+        // Both are thread-local reads in SDL, far cheaper than a redundant bind.
+        if (SDL_GL_GetCurrentContext() == _context && SDL_GL_GetCurrentWindow() == window)
+        {
+            return;
+        }
+        SDL_GL_MakeCurrent(window, _context);
+    }
+}
@@ -0,0 +1,28 @@
+#pragma once
+#include <SDL3/SDL_video.h>
+
+namespace Tbx::Plugins::SDLGraphicsContext
+{
+    // One GL context shared by every window the provider serves. GL objects are usable from
+    // all windows, and rendering several windows a frame only rebinds the context's drawable
+    // when the target window actually changes. What is current is read back from SDL rather
+    // than cached, so binds made elsewhere (overlays, other plugins) are never missed.
+    class SDLGLSharedContext
+    {
+    public:
+        SDLGLSharedContext() = default;
+        ~SDLGLSharedContext();
+
+        SDLGLSharedContext(const SDLGLSharedContext&) = delete;
+        SDLGLSharedContext& operator=(const SDLGLSharedContext&) = delete;
+
+        // Creates the context on first use, against the given window.
+        bool Attach(SDL_Window* window);
+
+        // Skips SDL_GL_MakeCurrent when the context is already current on the window.
+        void MakeCurrent(SDL_Window* window);
+
+    private:
+        SDL_GLContext _context = nullptr;
+    };
+}
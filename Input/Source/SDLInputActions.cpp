@@ -0,0 +1,202 @@
+#include "SDLInputActions.h"
+#include "SDLTbxInputCodeConverters.h"
+#include <cmath>
+
+namespace Tbx::Plugins::SDLInput
+{
+    static const ActionState EmptyActionState = {};
+    static const ActionBinding EmptyActionBinding = {};
+
+    static bool IsValidAction(int action, size_t count)
+    {
+        return action >= 0 && static_cast<size_t>(action) < count;
+    }
+
+    static bool HasSDLCode(const ActionBinding& binding)
+    {
+        switch (binding.Source)
+        {
+            case ActionSource::Key: return ConvertKey(binding.Code) != SDL_SCANCODE_UNKNOWN;
+            case ActionSource::MouseButton: return ConvertMouseButton(binding.Code) != 0;
+            case ActionSource::GamepadButton: return ConvertGamepadButton(binding.Code) != SDL_GAMEPAD_BUTTON_INVALID;
+            case ActionSource::GamepadAxis: return ConvertGamepadAxis(binding.Code) != SDL_GAMEPAD_AXIS_INVALID;
+        }
+        return false;
+    }
+
+    int InputActionMap::AddAction(std::string_view name)
+    {
+        const int existing = FindAction(name);
+        if (existing >= 0)
+        {
+            return existing;
+        }
+
+        _names.emplace_back(name);
+        _bindings.emplace_back();
+        _ranges.emplace_back();
+        _states.emplace_back();
+        return static_cast<int>(_names.size() - 1);
+    }
+
+    int InputActionMap::FindAction(std::string_view name) const
+    {
+        for (size_t i = 0; i < _names.size(); ++i)
+        {
+            if (_names[i] == name)
+            {
+                return static_cast<int>(i);
+            }
+        }
+        return -1;
+    }
+
+    size_t InputActionMap::GetActionCount() const
+    {
+        return _names.size();
+    }
+
+    bool InputActionMap::Bind(int action, const ActionBinding& binding)
+    {
+        if (!IsValidAction(action, _bindings.size()) || !HasSDLCode(binding) || binding.PlayerIndex >= MaxGamepads)
+        {
+            return false;
+        }
+
+        _bindings[action].push_back(binding);
+        _dirty = true;
+        return true;
+    }
+
+    void InputActionMap::ClearBindings(int action)
+    {
+        if (!IsValidAction(action, _bindings.size()))
+        {
+            return;
+        }
+
+        _bindings[action].clear();
+        _dirty = true;
+    }
+
+    size_t InputActionMap::GetBindingCount(int action) const
+    {
+        return IsValidAction(action, _bindings.size()) ? _bindings[action].size() : 0;
+    }
+
+    const ActionBinding& InputActionMap::GetBinding(int action, size_t index) const
+    {
+        if (!IsValidAction(action, _bindings.size()) || index >= _bindings[action].size())
+        {
+            return EmptyActionBinding;
+        }
+        return _bindings[action][index];
+    }
+
+    void InputActionMap::Update(const InputBits& current, const InputBits& pressedAny, const GamepadAxes& axes)
+    {
+        if (_dirty)
+        {
+            Compile();
+        }
+
+        for (size_t action = 0; action < _ranges.size(); ++action)
+        {
+            const ActionRange range = _ranges[action];
+            float value = 0.0f;
+            bool down = false;
+            bool tapped = false;
+
+            for (Uint32 i = range.First; i < range.First + range.Count; ++i)
+            {
+                const CompiledBinding& binding = _compiled[i];
+                float bindingValue = 0.0f;
+                if (binding.IsAxis)
+                {
+                    bindingValue = ReadAxis(axes, binding.Index) * binding.Scale;
+                    down |= bindingValue >= binding.Threshold;
+                }
+                else
+                {
+                    const bool held = TestBit(current, binding.Index);
+                    bindingValue = held ? binding.Scale : 0.0f;
+                    down |= held;
+                    tapped |= TestBit(pressedAny, binding.Index);
+                }
+
+                value = std::fabs(bindingValue) > std::fabs(value) ? bindingValue : value;
+            }
+
+            ActionState& state = _states[action];
+            const bool wasDown = state.Down;
+            state.Value = value;
+            state.Down = down;
+            state.Pressed = !wasDown && (down || tapped);
+            state.Released = wasDown && !down;
+        }
+    }
+
+    const ActionState& InputActionMap::GetState(int action) const
+    {
+        return IsValidAction(action, _states.size()) ? _states[action] : EmptyActionState;
+    }
+
+    void InputActionMap::Compile()
+    {
+        // Cleared rather than reallocated, so rebinding to a similar size reuses storage.
+        _compiled.clear();
+        for (size_t action = 0; action < _bindings.size(); ++action)
+        {
+            ActionRange& range = _ranges[action];
+            range.First = static_cast<Uint32>(_compiled.size());
+            for (const ActionBinding& binding : _bindings[action])
+            {
+                CompileBinding(binding);
+            }
+            range.Count = static_cast<Uint32>(_compiled.size()) - range.First;
+        }
+        _dirty = false;
+    }
+
+    void InputActionMap::CompileBinding(const ActionBinding& binding)
+    {
+        CompiledBinding compiled = {};
+        compiled.Scale = binding.Scale;
+        compiled.Threshold = binding.Threshold;
+
+        switch (binding.Source)
+        {
+            case ActionSource::Key:
+            {
+                compiled.Index = static_cast<Uint32>(KeyBit(ConvertKey(binding.Code)));
+                _compiled.push_back(compiled);
+                return;
+            }
+            case ActionSource::MouseButton:
+            {
+                compiled.Index = static_cast<Uint32>(MouseBit(ConvertMouseButton(binding.Code)));
+                _compiled.push_back(compiled);
+                return;
+            }
+            default:
+                break;
+        }
+
+        // Gamepad bindings for every player expand to one entry per slot.
+        const int firstSlot = binding.PlayerIndex < 0 ? 0 : binding.PlayerIndex;
+        const int lastSlot = binding.PlayerIndex < 0 ? MaxGamepads - 1 : binding.PlayerIndex;
+        for (int slot = firstSlot; slot <= lastSlot; ++slot)
+        {
+            if (binding.Source == ActionSource::GamepadButton)
+            {
+                compiled.Index = static_cast<Uint32>(GamepadBit(slot, ConvertGamepadButton(binding.Code)));
+            }
+            else
+            {
+                compiled.IsAxis = true;
+                compiled.Index = static_cast<Uint32>(GetAxisIndex(slot, ConvertGamepadAxis(binding.Code)));
+            }
+            _compiled.push_back(compiled);
+        }
+    }
+}
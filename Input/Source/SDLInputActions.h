@@ -0,0 +1,94 @@
+#pragma once
+#include "SDLInputAxes.h"
+#include "SDLInputBitset.h"
+#include <SDL3/SDL_stdinc.h>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Tbx::Plugins::SDLInput
+{
+    enum class ActionSource : Uint8
+    {
+        Key,
+        MouseButton,
+        GamepadButton,
+        GamepadAxis
+    };
+
+    // One input that drives an action. Codes are TBX key, mouse button, gamepad button or
+    // gamepad axis codes.
+    struct ActionBinding
+    {
+        ActionSource Source = ActionSource::Key;
+        int Code = -1;
+        // Gamepad sources only; -1 binds every player.
+        int PlayerIndex = -1;
+        // The action value this binding produces: digital inputs give Scale while held, axes
+        // give their filtered value times Scale.
+        float Scale = 1.0f;
+        // Axes hold the action down once their scaled value reaches this.
+        float Threshold = 0.5f;
+    };
+
+    struct ActionState
+    {
+        // The binding value with the largest magnitude.
+        float Value = 0.0f;
+        bool Down = false;
+        bool Pressed = false;
+        bool Released = false;
+    };
+
+    // Named actions bound to any mix of inputs. Bindings are compiled into flat tables of
+    // bit and axis indices, every action is resolved once per Update, and queries read the
+    // resolved state by action index. Rebinding only marks the tables stale; they are
+    // rebuilt by the next Update, never on the query path.
+    class InputActionMap
+    {
+    public:
+        // Returns the index of the named action, adding it if needed.
+        int AddAction(std::string_view name);
+        // Returns -1 when no action has the name.
+        int FindAction(std::string_view name) const;
+        size_t GetActionCount() const;
+
+        // Fails for unknown actions or codes without an SDL equivalent.
+        bool Bind(int action, const ActionBinding& binding);
+        void ClearBindings(int action);
+        size_t GetBindingCount(int action) const;
+        const ActionBinding& GetBinding(int action, size_t index) const;
+
+        // pressedAny carries transitions seen during the frame, so taps shorter than a frame
+        // still register as pressed.
+        void Update(const InputBits& current, const InputBits& pressedAny, const GamepadAxes& axes);
+
+        const ActionState& GetState(int action) const;
+
+    private:
+        struct CompiledBinding
+        {
+            Uint32 Index = 0;
+            bool IsAxis = false;
+            float Scale = 1.0f;
+            float Threshold = 0.5f;
+        };
+
+        struct ActionRange
+        {
+            Uint32 First = 0;
+            Uint32 Count = 0;
+        };
+
+        void Compile();
+        void CompileBinding(const ActionBinding& binding);
+
+    private:
+        std::vector<std::string> _names = {};
+        std::vector<std::vector<ActionBinding>> _bindings = {};
+        std::vector<CompiledBinding> _compiled = {};
+        std::vector<ActionRange> _ranges = {};
+        std::vector<ActionState> _states = {};
+        bool _dirty = false;
+    };
+}
@@ -0,0 +1,78 @@
+#include "SDLInputAxes.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Tbx::Plugins::SDLInput
+{
+    // Remaps a magnitude from [inner, outer] to [0, 1] and shapes it by the response curve.
+    static inline float ShapeMagnitude(float magnitude, float inner, float invRange, float exponent)
+    {
+        const float scaled = std::clamp((magnitude - inner) * invRange, 0.0f, 1.0f);
+        return exponent == 1.0f ? scaled : std::pow(scaled, exponent);
+    }
+
+    static inline float InverseRange(float inner, float outer)
+    {
+        return outer > inner ? 1.0f / (outer - inner) : 0.0f;
+    }
+
+    void FilterGamepadAxes(const GamepadAxes& raw, GamepadAxes& filtered, const AxisFilterSettings& settings)
+    {
+        // Shaped values land in a local copy first so smoothing can blend in one final loop.
+        GamepadAxes shaped = {};
+        // Without a deadzone the full range is kept, but the response curve still applies.
+        const bool useDeadzone = settings.Deadzone != AxisDeadzone::None;
+        const float exponent = settings.ResponseExponent;
+        const float stickInner = useDeadzone ? settings.StickInner : 0.0f;
+        const float stickRange = useDeadzone ? InverseRange(settings.StickInner, settings.StickOuter) : 1.0f;
+
+        // The loops below have no data-dependent branches or cross-lane dependencies, so the
+        // compiler can vectorize them over all pads.
+        switch (settings.Deadzone)
+        {
+            // With no deadzone the inner edge is 0 and the range 1, so the per-axis path only
+            // applies the response curve and leaves diagonals at full reach.
+            case AxisDeadzone::None:
+            case AxisDeadzone::Axial:
+            {
+                for (size_t i = 0; i < AxisLaneCount; ++i)
+                {
+                    const float x = raw.StickX[i];
+                    const float y = raw.StickY[i];
+                    shaped.StickX[i] = std::copysign(ShapeMagnitude(std::fabs(x), stickInner, stickRange, exponent), x);
+                    shaped.StickY[i] = std::copysign(ShapeMagnitude(std::fabs(y), stickInner, stickRange, exponent), y);
+                }
+                break;
+            }
+            case AxisDeadzone::Radial:
+            {
+                for (size_t i = 0; i < AxisLaneCount; ++i)
+                {
+                    const float x = raw.StickX[i];
+                    const float y = raw.StickY[i];
+                    const float magnitude = std::sqrt(x * x + y * y);
+                    const float shapedMagnitude = ShapeMagnitude(magnitude, stickInner, stickRange, exponent);
+                    const float scale = magnitude > 0.0f ? shapedMagnitude / magnitude : 0.0f;
+                    shaped.StickX[i] = x * scale;
+                    shaped.StickY[i] = y * scale;
+                }
+                break;
+            }
+        }
+
+        const float triggerInner = useDeadzone ? settings.TriggerInner : 0.0f;
+        const float triggerRange = useDeadzone ? InverseRange(settings.TriggerInner, settings.TriggerOuter) : 1.0f;
+        for (size_t i = 0; i < AxisLaneCount; ++i)
+        {
+            shaped.Trigger[i] = ShapeMagnitude(raw.Trigger[i], triggerInner, triggerRange, exponent);
+        }
+
+        const float keep = std::clamp(settings.Smoothing, 0.0f, 0.99f);
+        for (size_t i = 0; i < AxisLaneCount; ++i)
+        {
+            filtered.StickX[i] = shaped.StickX[i] + keep * (filtered.StickX[i] - shaped.StickX[i]);
+            filtered.StickY[i] = shaped.StickY[i] + keep * (filtered.StickY[i] - shaped.StickY[i]);
+            filtered.Trigger[i] = shaped.Trigger[i] + keep * (filtered.Trigger[i] - shaped.Trigger[i]);
+        }
+    }
+}
@@ -0,0 +1,109 @@
+#pragma once
+#include "SDLInputBitset.h"
+#include <SDL3/SDL_gamepad.h>
+#include <array>
+#include <cstddef>
+
+namespace Tbx::Plugins::SDLInput
+{
+    // Axes of every gamepad slot, stored by kind so one filter pass covers all pads. Each slot
+    // has two sticks and two triggers; lane = slot * 2 + (0 for left, 1 for right).
+    inline constexpr size_t AxisLaneCount = MaxGamepads * 2;
+
+    static_assert(SDL_GAMEPAD_AXIS_COUNT == 6, "Axis lanes assume two sticks and two triggers.");
+
+    struct GamepadAxes
+    {
+        std::array<float, AxisLaneCount> StickX = {};
+        std::array<float, AxisLaneCount> StickY = {};
+        std::array<float, AxisLaneCount> Trigger = {};
+    };
+
+    enum class AxisDeadzone
+    {
+        // Raw values pass through with only the response curve applied to each axis.
+        None,
+        // Each stick axis is zeroed independently, which snaps diagonals to the cardinals.
+        Axial,
+        // The deadzone is applied to stick magnitude, which keeps direction intact.
+        Radial
+    };
+
+    struct AxisFilterSettings
+    {
+        AxisDeadzone Deadzone = AxisDeadzone::Radial;
+        // Normalized ranges are remapped from [Inner, Outer] to [0, 1].
+        float StickInner = 0.15f;
+        float StickOuter = 0.95f;
+        float TriggerInner = 0.05f;
+        float TriggerOuter = 1.0f;
+        // Applied to the remapped magnitude; above 1 gives finer control near the center.
+        float ResponseExponent = 1.0f;
+        // Fraction of the previous filtered value kept each Update, in [0, 1).
+        float Smoothing = 0.0f;
+    };
+
+    // Locates an axis by SDL_GamepadAxis. Returns nullptr for unknown axes.
+    inline float* FindAxis(GamepadAxes& axes, size_t slot, int sdlAxis)
+    {
+        switch (sdlAxis)
+        {
+            case SDL_GAMEPAD_AXIS_LEFTX: return &axes.StickX[slot * 2];
+            case SDL_GAMEPAD_AXIS_LEFTY: return &axes.StickY[slot * 2];
+            case SDL_GAMEPAD_AXIS_RIGHTX: return &axes.StickX[slot * 2 + 1];
+            case SDL_GAMEPAD_AXIS_RIGHTY: return &axes.StickY[slot * 2 + 1];
+            case SDL_GAMEPAD_AXIS_LEFT_TRIGGER: return &axes.Trigger[slot * 2];
+            case SDL_GAMEPAD_AXIS_RIGHT_TRIGGER: return &axes.Trigger[slot * 2 + 1];
+            default: return nullptr;
+        }
+    }
+
+    // Reads an axis by SDL_GamepadAxis, or zero for unknown axes.
+    inline float ReadAxis(const GamepadAxes& axes, size_t slot, int sdlAxis)
+    {
+        const float* value = FindAxis(const_cast<GamepadAxes&>(axes), slot, sdlAxis);
+        return value != nullptr ? *value : 0.0f;
+    }
+
+    // Flat index of an axis across StickX, StickY and Trigger, in that order, or -1 for
+    // unknown axes. Lets tables refer to any axis with a single integer.
+    constexpr int GetAxisIndex(size_t slot, int sdlAxis)
+    {
+        const int lane = static_cast<int>(slot * 2);
+        switch (sdlAxis)
+        {
+            case SDL_GAMEPAD_AXIS_LEFTX: return lane;
+            case SDL_GAMEPAD_AXIS_RIGHTX: return lane + 1;
+            case SDL_GAMEPAD_AXIS_LEFTY: return static_cast<int>(AxisLaneCount) + lane;
+            case SDL_GAMEPAD_AXIS_RIGHTY: return static_cast<int>(AxisLaneCount) + lane + 1;
+            case SDL_GAMEPAD_AXIS_LEFT_TRIGGER: return static_cast<int>(AxisLaneCount) * 2 + lane;
+            case SDL_GAMEPAD_AXIS_RIGHT_TRIGGER: return static_cast<int>(AxisLaneCount) * 2 + lane + 1;
+            default: return -1;
+        }
+    }
+
+    inline float ReadAxis(const GamepadAxes& axes, size_t index)
+    {
+        const size_t lane = index % AxisLaneCount;
+        switch (index / AxisLaneCount)
+        {
+            case 0: return axes.StickX[lane];
+            case 1: return axes.StickY[lane];
+            default: return axes.Trigger[lane];
+        }
+    }
+
+    inline void ClearSlotAxes(GamepadAxes& axes, size_t slot)
+    {
+        for (size_t lane = slot * 2; lane < slot * 2 + 2; ++lane)
+        {
+            axes.StickX[lane] = 0.0f;
+            axes.StickY[lane] = 0.0f;
+            axes.Trigger[lane] = 0.0f;
+        }
+    }
+
+    // Applies deadzones, the response curve and smoothing to every lane at once. filtered
+    // holds the previous result on entry, which smoothing blends from.
+    void FilterGamepadAxes(const GamepadAxes& raw, GamepadAxes& filtered, const AxisFilterSettings& settings);
+}
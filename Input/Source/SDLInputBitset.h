@@ -0,0 +1,66 @@
+#pragma once
+#include <SDL3/SDL_gamepad.h>
+#include <SDL3/SDL_scancode.h>
+#include <SDL3/SDL_stdinc.h>
+#include <array>
+#include <cstddef>
+
+namespace Tbx::Plugins::SDLInput
+{
+    inline constexpr int MaxGamepads = 16;
+
+    // Every digital input lives in one flat array of 64-bit words: the keyboard by scancode,
+    // then the mouse button mask, then one word per gamepad slot. Frame edges for all devices
+    // come from a single pass over the array.
+    inline constexpr size_t KeyboardWord = 0;
+    inline constexpr size_t KeyboardWordCount = (SDL_SCANCODE_COUNT + 63) / 64;
+    inline constexpr size_t MouseWord = KeyboardWord + KeyboardWordCount;
+    inline constexpr size_t GamepadWord = MouseWord + 1;
+    inline constexpr size_t InputWordCount = GamepadWord + MaxGamepads;
+
+    static_assert(SDL_GAMEPAD_BUTTON_COUNT <= 64, "Gamepad buttons must fit in one word per slot.");
+
+    using InputBits = std::array<Uint64, InputWordCount>;
+
+    constexpr size_t KeyBit(size_t scancode)
+    {
+        return KeyboardWord * 64 + scancode;
+    }
+
+    // SDL numbers mouse buttons from one; bit 0 holds button 1, matching SDL_BUTTON_MASK.
+    constexpr size_t MouseBit(size_t sdlButton)
+    {
+        return MouseWord * 64 + (sdlButton - 1);
+    }
+
+    constexpr size_t GamepadBit(size_t slot, size_t sdlButton)
+    {
+        return (GamepadWord + slot) * 64 + sdlButton;
+    }
+
+    constexpr bool TestBit(const InputBits& bits, size_t bit)
+    {
+        return (bits[bit / 64] >> (bit % 64)) & 1;
+    }
+
+    constexpr void SetBit(InputBits& bits, size_t bit, bool value)
+    {
+        const Uint64 mask = Uint64{ 1 } << (bit % 64);
+        bits[bit / 64] = value ? (bits[bit / 64] | mask) : (bits[bit / 64] & ~mask);
+    }
+
+    // Rolls the live state into the current frame and derives this frame's edges.
+    inline void AdvanceInputBits(const InputBits& live, InputBits& curr, InputBits& prev, InputBits& pressed, InputBits& released)
+    {
+        for (size_t i = 0; i < InputWordCount; ++i)
+        {
+            const Uint64 before = curr[i];
+            const Uint64 after = live[i];
+            const Uint64 changed = before ^ after;
+            prev[i] = before;
+            curr[i] = after;
+            pressed[i] = changed & after;
+            released[i] = changed & before;
+        }
+    }
+}
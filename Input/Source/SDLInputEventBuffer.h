@@ -0,0 +1,101 @@
+#pragma once
+#include <SDL3/SDL_stdinc.h>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <span>
+
+namespace Tbx::Plugins::SDLInput
+{
+    enum class InputEventType : Uint8
+    {
+        Key,
+        MouseButton,
+        GamepadButton
+    };
+
+    // A single digital transition, with codes already converted to TBX codes.
+    struct InputEvent
+    {
+        // SDL event timestamp, in nanoseconds since SDL initialization.
+        Uint64 Timestamp = 0;
+        InputEventType Type = InputEventType::Key;
+        // Gamepad player index; zero for keyboard and mouse.
+        Uint8 PlayerIndex = 0;
+        Sint16 Code = -1;
+        bool Down = false;
+    };
+
+    // Fixed-size ring of input samples. Items pushed between two EndFrame calls become that
+    // frame's items, readable in arrival order until the next EndFrame. Nothing is allocated
+    // after construction. The readable frame keeps its slots while the next one fills, so a
+    // frame only gets what the previous one left free: half the capacity under steady load.
+    // If a frame produces more items than fit, the excess is counted and dropped.
+    template <typename T, size_t N>
+    class FrameRingBuffer
+    {
+    public:
+        static constexpr size_t Capacity = N;
+
+        void Push(const T& item)
+        {
+            if (_write - _frameBegin >= Capacity)
+            {
+                _dropped++;
+                return;
+            }
+
+            _items[_write % Capacity] = item;
+            _write++;
+        }
+
+        void EndFrame()
+        {
+            _frameBegin = _frameEnd;
+            _frameEnd = _write;
+        }
+
+        // Discards everything, including the readable frame.
+        void Clear()
+        {
+            _frameBegin = _write;
+            _frameEnd = _write;
+        }
+
+        size_t GetFrameCount() const
+        {
+            return _frameEnd - _frameBegin;
+        }
+
+        const T& GetFrameItem(size_t index) const
+        {
+            return _items[(_frameBegin + index) % Capacity];
+        }
+
+        // Copies as much of the frame as fits, in at most two block copies, and returns the
+        // number of items written.
+        size_t CopyFrame(std::span<T> output) const
+        {
+            const size_t count = std::min(GetFrameCount(), output.size());
+            const size_t first = _frameBegin % Capacity;
+            const size_t head = std::min(count, Capacity - first);
+            std::copy_n(_items.begin() + first, head, output.begin());
+            std::copy_n(_items.begin(), count - head, output.begin() + head);
+            return count;
+        }
+
+        Uint64 GetDroppedCount() const
+        {
+            return _dropped;
+        }
+
+    private:
+        std::array<T, Capacity> _items = {};
+        size_t _write = 0;
+        size_t _frameBegin = 0;
+        size_t _frameEnd = 0;
+        Uint64 _dropped = 0;
+    };
+
+    using InputEventBuffer = FrameRingBuffer<InputEvent, 1024>;
+}
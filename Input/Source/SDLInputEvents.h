@@ -0,0 +1,23 @@
+#pragma once
+#include "SDLInputEventBuffer.h"
+#include "Tbx/Events/Event.h"
+#include "Tbx/Input/IInputHandler.h"
+#include <span>
+
+namespace Tbx::Plugins::SDLInput
+{
+    // Posted once per Update when input changed during the frame, so systems can subscribe
+    // instead of polling. Transitions hold every key, mouse button and gamepad button change
+    // of the frame in arrival order. The span points into the input plugin and is only valid
+    // until its next Update.
+    struct InputChangedEvent : public Event
+    {
+        InputChangedEvent(std::span<const InputEvent> transitions, const Vector2& mouseDelta)
+            : Transitions(transitions), MouseDelta(mouseDelta)
+        {
+        }
+
+        std::span<const InputEvent> Transitions = {};
+        Vector2 MouseDelta = { 0, 0 };
+    };
+}
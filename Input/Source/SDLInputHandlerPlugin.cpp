@@ -2,7 +2,10 @@
 #include "SDLTbxInputCodeConverters.h"
 #include "Tbx/Debug/Asserts.h"
 #include "Tbx/Debug/Tracers.h"
-#include <cstring>
+#include <SDL3/SDL_timer.h>
+#include <algorithm>
+#include <bit>
+#include <cmath>
 
 namespace Tbx::Plugins::SDLInput
 {
@@ -15,6 +18,7 @@ namespace Tbx::Plugins::SDLInput
     }
 
     SDLInputHandlerPlugin::SDLInputHandlerPlugin(Ref<EventBus> eventBus)
+        : _eventCarrier(eventBus)
     {
         TBX_ASSERT(SDL_Init(SDL_INIT_GAMEPAD) != 0, "Failed to initialize SDL");
         TBX_ASSERT(SDL_Init(SDL_INIT_HAPTIC) != 0, "Failed to initialize SDL");
@@ -22,6 +26,9 @@ namespace Tbx::Plugins::SDLInput
 
         SDL_AddEventWatch(PumpSDLEventToHandler, this);
         InitGamepads();
+        SeedKeyboard();
+        SeedMouse();
+        _publishedEvents.reserve(InputEventBuffer::Capacity);
 
         TBX_TRACE_INFO("SD3Input: SDL Input initialized.");
     }
@@ -29,6 +36,8 @@ namespace Tbx::Plugins::SDLInput
     SDLInputHandlerPlugin::~SDLInputHandlerPlugin()
     {
         SDL_RemoveEventWatch(PumpSDLEventToHandler, this);
+        StopRecording();
+        StopSampling();
         CloseGamepads();
 
         SDL_QuitSubSystem(SDL_INIT_GAMEPAD);
@@ -44,84 +53,182 @@ namespace Tbx::Plugins::SDLInput
 
     void SDLInputHandlerPlugin::Update()
     {
-        // Store previous states
-        _prevKeyState = _currKeyState;
-        _prevMouseState = _currMouseState;
-        _prevGamepadBtnState = _currGamepadBtnState;
+        // Gamepad events raised on the sampler thread are applied here, in the order they
+        // were raised.
+        SDL_Event sampled = {};
+        while (_sampler.GetEvents().Pop(sampled))
+        {
+            HandleSDLEvent(&sampled);
+        }
 
-        // Get latest states
-        for (auto& [id, gamepad] : _gamepads)
+        if (_replay.IsOpen())
         {
-            if (!gamepad) continue;
-            std::array<bool, SDL_GAMEPAD_BUTTON_COUNT> buttons{};
-            for (int b = 0; b < SDL_GAMEPAD_BUTTON_COUNT; ++b)
+            ReplayFrame();
+        }
+        else
+        {
+            OpenQueuedGamepads();
+
+            // All input is kept live by events; the mouse is logged as one state per frame.
+            InputRecord mouse = {};
+            mouse.Type = InputRecordType::MouseState;
+            mouse.MouseButtons = static_cast<Uint32>(_liveInput[MouseWord]);
+            _mouseMotion.EndFrame(mouse.MouseX, mouse.MouseY, mouse.MouseDeltaX, mouse.MouseDeltaY);
+
+            const bool changed = !_hasMouseState
+                || mouse.MouseButtons != _lastMouseState.MouseButtons
+                || mouse.MouseX != _lastMouseState.MouseX || mouse.MouseY != _lastMouseState.MouseY
+                || mouse.MouseDeltaX != _lastMouseState.MouseDeltaX || mouse.MouseDeltaY != _lastMouseState.MouseDeltaY;
+            if (changed)
             {
-                buttons[b] = SDL_GetGamepadButton(gamepad, static_cast<SDL_GamepadButton>(b));
+                Submit(mouse);
+                _lastMouseState = mouse;
+                _hasMouseState = true;
             }
-            _currGamepadBtnState[id] = buttons;
         }
-        const bool* keyboardState = SDL_GetKeyboardState(nullptr);
-        if (keyboardState)
+
+        if (_recorder.IsOpen())
         {
-            std::memcpy(_currKeyState.data(), keyboardState, sizeof(bool) * SDL_SCANCODE_COUNT);
+            InputRecord frame = {};
+            frame.Type = InputRecordType::Frame;
+            _recorder.Write(frame);
         }
-        _currMouseState = SDL_GetMouseState(nullptr, nullptr);
 
-        // Update the mouse pos every frame
-        float x, y;
-        SDL_GetMouseState(&x, &y);
-        _mousePos = Vector2(x, y);
+        FilterGamepadAxes(_liveAxes, _axes, _axisFilter);
+        AdvanceInputBits(_liveInput, _currInput, _prevInput, _pressedInput, _releasedInput);
+        _pressedAny = _livePressedAny;
+        _releasedAny = _liveReleasedAny;
+        _livePressedAny = {};
+        _liveReleasedAny = {};
+        _events.EndFrame();
+        MeasureVisibleLatency();
+        for (GamepadSensorStreams& sensors : _sensors)
+        {
+            sensors.EndFrame();
+        }
+        _actions.Update(_currInput, _pressedAny, _axes);
+        PostInputChanges();
+    }
+
+    void SDLInputHandlerPlugin::SetInputEventsEnabled(bool enabled)
+    {
+        _publishEvents = enabled;
+    }
+
+    void SDLInputHandlerPlugin::PostInputChanges()
+    {
+        const size_t count = _events.GetFrameCount();
+        const bool mouseMoved = _mouseDelta.X != 0.0f || _mouseDelta.Y != 0.0f;
+        if (!_publishEvents || (count == 0 && !mouseMoved))
+        {
+            return;
+        }
 
-        // Update mouse delta every frame
-        float x_delta, y_delta;
-        Uint32 button_state = SDL_GetRelativeMouseState(&x_delta, &y_delta);
-        _mouseDelta = Vector2(x_delta, y_delta);
+        // One event per frame however many transitions it holds, so dispatch cost does not
+        // grow with input volume.
+        _publishedEvents.resize(count);
+        _events.CopyFrame(_publishedEvents);
+        _eventCarrier.Post(InputChangedEvent(_publishedEvents, _mouseDelta));
     }
 
     /* ==== Keyboard ==== */
 
     bool SDLInputHandlerPlugin::IsKeyDown(int keyCode) const
     {
-        SDL_Scancode sc = ConvertKey(keyCode);
-        return _currKeyState[sc] && !_prevKeyState[sc];
+        NoteRead(InputDevice::Keyboard);
+        return TestBit(_pressedInput, KeyBit(ConvertKey(keyCode)));
     }
 
     bool SDLInputHandlerPlugin::IsKeyUp(int keyCode) const
     {
-        SDL_Scancode sc = ConvertKey(keyCode);
-        return !_currKeyState[sc] && _prevKeyState[sc];
+        NoteRead(InputDevice::Keyboard);
+        return TestBit(_releasedInput, KeyBit(ConvertKey(keyCode)));
     }
 
     bool SDLInputHandlerPlugin::IsKeyHeld(int keyCode) const
     {
-        SDL_Scancode sc = ConvertKey(keyCode);
-        return _currKeyState[sc] && _prevKeyState[sc];
+        NoteRead(InputDevice::Keyboard);
+        const size_t bit = KeyBit(ConvertKey(keyCode));
+        return TestBit(_currInput, bit) && TestBit(_prevInput, bit);
+    }
+
+    size_t SDLInputHandlerPlugin::GetChangedKeys(std::span<KeyChange> changes) const
+    {
+        NoteRead(InputDevice::Keyboard);
+        size_t count = 0;
+        for (size_t word = KeyboardWord; word < KeyboardWord + KeyboardWordCount; ++word)
+        {
+            Uint64 changed = _pressedInput[word] | _releasedInput[word];
+            while (changed != 0 && count < changes.size())
+            {
+                const int bit = std::countr_zero(changed);
+                changed &= changed - 1;
+
+                const auto scancode = static_cast<SDL_Scancode>((word - KeyboardWord) * 64 + static_cast<size_t>(bit));
+                const int key = ConvertScancode(scancode);
+                if (key < 0) continue;
+
+                changes[count].Key = key;
+                changes[count].Pressed = (_pressedInput[word] >> bit) & 1;
+                count++;
+            }
+        }
+        return count;
+    }
+
+    bool SDLInputHandlerPlugin::WasKeyPressed(int keyCode) const
+    {
+        NoteRead(InputDevice::Keyboard);
+        return TestBit(_pressedAny, KeyBit(ConvertKey(keyCode)));
+    }
+
+    bool SDLInputHandlerPlugin::WasKeyReleased(int keyCode) const
+    {
+        NoteRead(InputDevice::Keyboard);
+        return TestBit(_releasedAny, KeyBit(ConvertKey(keyCode)));
     }
 
     /* ==== Mouse ==== */
 
     bool SDLInputHandlerPlugin::IsMouseButtonDown(int button) const
     {
+        NoteRead(InputDevice::Mouse);
         int sdlBtn = ConvertMouseButton(button);
-        bool curr = _currMouseState & SDL_BUTTON_MASK(sdlBtn);
-        bool prev = _prevMouseState & SDL_BUTTON_MASK(sdlBtn);
-        return curr && !prev;
+        if (sdlBtn == 0) return false;
+        return TestBit(_pressedInput, MouseBit(sdlBtn));
     }
 
     bool SDLInputHandlerPlugin::IsMouseButtonUp(int button) const
     {
+        NoteRead(InputDevice::Mouse);
         int sdlBtn = ConvertMouseButton(button);
-        bool curr = _currMouseState & SDL_BUTTON_MASK(sdlBtn);
-        bool prev = _prevMouseState & SDL_BUTTON_MASK(sdlBtn);
-        return !curr && prev;
+        if (sdlBtn == 0) return false;
+        return TestBit(_releasedInput, MouseBit(sdlBtn));
     }
 
     bool SDLInputHandlerPlugin::IsMouseButtonHeld(int button) const
     {
+        NoteRead(InputDevice::Mouse);
+        int sdlBtn = ConvertMouseButton(button);
+        if (sdlBtn == 0) return false;
+        const size_t bit = MouseBit(sdlBtn);
+        return TestBit(_currInput, bit) && TestBit(_prevInput, bit);
+    }
+
+    bool SDLInputHandlerPlugin::WasMouseButtonPressed(int button) const
+    {
+        NoteRead(InputDevice::Mouse);
         int sdlBtn = ConvertMouseButton(button);
-        bool curr = _currMouseState & SDL_BUTTON_MASK(sdlBtn);
-        bool prev = _prevMouseState & SDL_BUTTON_MASK(sdlBtn);
-        return curr && prev;
+        if (sdlBtn == 0) return false;
+        return TestBit(_pressedAny, MouseBit(sdlBtn));
+    }
+
+    bool SDLInputHandlerPlugin::WasMouseButtonReleased(int button) const
+    {
+        NoteRead(InputDevice::Mouse);
+        int sdlBtn = ConvertMouseButton(button);
+        if (sdlBtn == 0) return false;
+        return TestBit(_releasedAny, MouseBit(sdlBtn));
     }
 
     Vector2 SDLInputHandlerPlugin::GetMousePosition() const
@@ -129,6 +236,16 @@ namespace Tbx::Plugins::SDLInput
         return _mousePos;
     }
 
+    void SDLInputHandlerPlugin::SetMouseMotionPathEnabled(bool enabled)
+    {
+        _mouseMotion.SetPathEnabled(enabled);
+    }
+
+    size_t SDLInputHandlerPlugin::GetMouseMotionPath(std::span<MouseMotionSample> samples) const
+    {
+        return _mouseMotion.GetPath().CopyFrame(samples);
+    }
+
     Vector2 SDLInputHandlerPlugin::GetMouseDelta() const
     {
         return _mouseDelta;
@@ -138,71 +255,695 @@ namespace Tbx::Plugins::SDLInput
 
     bool SDLInputHandlerPlugin::IsGamepadButtonDown(int playerIndex, int button) const
     {
-        const auto currIt = _currGamepadBtnState.find(playerIndex);
-        const auto prevIt = _prevGamepadBtnState.find(playerIndex);
-        if (currIt == _currGamepadBtnState.end()) return false;
+        NoteRead(InputDevice::Gamepad);
+        const int slot = GetButtonSlot(playerIndex);
         const int sdlBtn = ConvertGamepadButton(button);
-        const bool curr = currIt->second[sdlBtn];
-        const bool prev = (prevIt != _prevGamepadBtnState.end()) ? prevIt->second[sdlBtn] : false;
-        return curr && !prev;
+        if (slot < 0 || sdlBtn < 0 || sdlBtn >= SDL_GAMEPAD_BUTTON_COUNT) return false;
+        return TestBit(_pressedInput, GamepadBit(slot, sdlBtn));
     }
 
     bool SDLInputHandlerPlugin::IsGamepadButtonUp(int playerIndex, int button) const
     {
-        const auto currIt = _currGamepadBtnState.find(playerIndex);
-        const auto prevIt = _prevGamepadBtnState.find(playerIndex);
-        if (currIt == _currGamepadBtnState.end()) return false;
-        int sdlBtn = ConvertGamepadButton(button);
-        const bool curr = currIt->second[sdlBtn];
-        const bool prev = (prevIt != _prevGamepadBtnState.end()) ? prevIt->second[sdlBtn] : false;
-        return !curr && prev;
+        NoteRead(InputDevice::Gamepad);
+        const int slot = GetButtonSlot(playerIndex);
+        const int sdlBtn = ConvertGamepadButton(button);
+        if (slot < 0 || sdlBtn < 0 || sdlBtn >= SDL_GAMEPAD_BUTTON_COUNT) return false;
+        return TestBit(_releasedInput, GamepadBit(slot, sdlBtn));
     }
 
     bool SDLInputHandlerPlugin::IsGamepadButtonHeld(int playerIndex, int button) const
     {
-        const auto currIt = _currGamepadBtnState.find(playerIndex);
-        const auto prevIt = _prevGamepadBtnState.find(playerIndex);
-        if (currIt == _currGamepadBtnState.end()) return false;
-        int sdlBtn = ConvertGamepadButton(button);
-        const bool curr = currIt->second[sdlBtn];
-        const bool prev = (prevIt != _prevGamepadBtnState.end()) ? prevIt->second[sdlBtn] : false;
-        return curr && prev;
+        NoteRead(InputDevice::Gamepad);
+        const int slot = GetButtonSlot(playerIndex);
+        const int sdlBtn = ConvertGamepadButton(button);
+        if (slot < 0 || sdlBtn < 0 || sdlBtn >= SDL_GAMEPAD_BUTTON_COUNT) return false;
+        const size_t bit = GamepadBit(slot, sdlBtn);
+        return TestBit(_currInput, bit) && TestBit(_prevInput, bit);
+    }
+
+    bool SDLInputHandlerPlugin::WasGamepadButtonPressed(int playerIndex, int button) const
+    {
+        NoteRead(InputDevice::Gamepad);
+        const int slot = GetButtonSlot(playerIndex);
+        const int sdlBtn = ConvertGamepadButton(button);
+        if (slot < 0 || sdlBtn < 0 || sdlBtn >= SDL_GAMEPAD_BUTTON_COUNT) return false;
+        return TestBit(_pressedAny, GamepadBit(slot, sdlBtn));
+    }
+
+    bool SDLInputHandlerPlugin::WasGamepadButtonReleased(int playerIndex, int button) const
+    {
+        NoteRead(InputDevice::Gamepad);
+        const int slot = GetButtonSlot(playerIndex);
+        const int sdlBtn = ConvertGamepadButton(button);
+        if (slot < 0 || sdlBtn < 0 || sdlBtn >= SDL_GAMEPAD_BUTTON_COUNT) return false;
+        return TestBit(_releasedAny, GamepadBit(slot, sdlBtn));
     }
+
     float SDLInputHandlerPlugin::GetGamepadAxis(int playerIndex, int axis) const
     {
-        const auto sdlAxis = ConvertGamepadAxis(axis);
-        if (_gamepads.find(playerIndex) == _gamepads.end())
+        NoteRead(InputDevice::Gamepad);
+        const int slot = GetConnectedSlot(playerIndex);
+        if (slot < 0)
+        {
+            return 0.0f;
+        }
+        return ReadAxis(_axes, slot, ConvertGamepadAxis(axis));
+    }
+
+    float SDLInputHandlerPlugin::GetRawGamepadAxis(int playerIndex, int axis) const
+    {
+        const int slot = GetConnectedSlot(playerIndex);
+        if (slot < 0)
+        {
+            return 0.0f;
+        }
+        return ReadAxis(_liveAxes, slot, ConvertGamepadAxis(axis));
+    }
+
+    void SDLInputHandlerPlugin::SetAxisFilter(const AxisFilterSettings& settings)
+    {
+        _axisFilter = settings;
+    }
+
+    const AxisFilterSettings& SDLInputHandlerPlugin::GetAxisFilter() const
+    {
+        return _axisFilter;
+    }
+
+    /* ==== Sensors ==== */
+
+    size_t SDLInputHandlerPlugin::GetGyroSamples(int playerIndex, std::span<MotionSample> samples) const
+    {
+        const int slot = GetConnectedSlot(playerIndex);
+        return slot < 0 ? 0 : _sensors[slot].Gyro.CopyFrame(samples);
+    }
+
+    size_t SDLInputHandlerPlugin::GetAccelSamples(int playerIndex, std::span<MotionSample> samples) const
+    {
+        const int slot = GetConnectedSlot(playerIndex);
+        return slot < 0 ? 0 : _sensors[slot].Accel.CopyFrame(samples);
+    }
+
+    size_t SDLInputHandlerPlugin::GetTouchpadSamples(int playerIndex, std::span<TouchSample> samples) const
+    {
+        const int slot = GetConnectedSlot(playerIndex);
+        return slot < 0 ? 0 : _sensors[slot].Touch.CopyFrame(samples);
+    }
+
+    float SDLInputHandlerPlugin::GetMotionSensorRate(int playerIndex) const
+    {
+        const int slot = GetConnectedSlot(playerIndex);
+        if (slot < 0 || _gamepads[slot].Handle == nullptr)
         {
             return 0.0f;
         }
+        return SDL_GetGamepadSensorDataRate(_gamepads[slot].Handle, SDL_SENSOR_GYRO);
+    }
+
+    void SDLInputHandlerPlugin::SetMotionSensorsEnabled(bool enabled)
+    {
+        _motionSensorsEnabled = enabled;
+        for (const GamepadSlot& gamepad : _gamepads)
+        {
+            if (gamepad.Handle != nullptr)
+            {
+                EnableMotionSensors(gamepad.Handle, enabled);
+            }
+        }
+    }
+
+    void SDLInputHandlerPlugin::EnableMotionSensors(SDL_Gamepad* gamepad, bool enabled)
+    {
+        // SDL only sends sensor events for sensors that were explicitly enabled.
+        for (const SDL_SensorType sensor : { SDL_SENSOR_GYRO, SDL_SENSOR_ACCEL })
+        {
+            if (SDL_GamepadHasSensor(gamepad, sensor))
+            {
+                SDL_SetGamepadSensorEnabled(gamepad, sensor, enabled);
+            }
+        }
+    }
+
+    /* ==== Actions ==== */
+
+    int SDLInputHandlerPlugin::AddAction(std::string_view name)
+    {
+        return _actions.AddAction(name);
+    }
+
+    int SDLInputHandlerPlugin::FindAction(std::string_view name) const
+    {
+        return _actions.FindAction(name);
+    }
+
+    bool SDLInputHandlerPlugin::BindAction(int action, const ActionBinding& binding)
+    {
+        if (!_actions.Bind(action, binding))
+        {
+            TBX_TRACE_WARNING("SD3Input: Cannot bind input code {} to action {}.", binding.Code, action);
+            return false;
+        }
+        return true;
+    }
+
+    void SDLInputHandlerPlugin::ClearActionBindings(int action)
+    {
+        _actions.ClearBindings(action);
+    }
+
+    bool SDLInputHandlerPlugin::IsActionDown(int action) const
+    {
+        NoteActionRead();
+        return _actions.GetState(action).Down;
+    }
+
+    bool SDLInputHandlerPlugin::WasActionPressed(int action) const
+    {
+        NoteActionRead();
+        return _actions.GetState(action).Pressed;
+    }
+
+    bool SDLInputHandlerPlugin::WasActionReleased(int action) const
+    {
+        NoteActionRead();
+        return _actions.GetState(action).Released;
+    }
+
+    float SDLInputHandlerPlugin::GetActionValue(int action) const
+    {
+        NoteActionRead();
+        return _actions.GetState(action).Value;
+    }
+
+    /* ==== Events ==== */
+
+    size_t SDLInputHandlerPlugin::GetFrameEventCount() const
+    {
+        return _events.GetFrameCount();
+    }
+
+    const InputEvent& SDLInputHandlerPlugin::GetFrameEvent(size_t index) const
+    {
+        return _events.GetFrameItem(index);
+    }
+
+    void SDLInputHandlerPlugin::RecordTransition(size_t bit, InputEventType type, int playerIndex, int code, bool down, Uint64 timestamp)
+    {
+        SetBit(down ? _livePressedAny : _liveReleasedAny, bit, true);
+        if (code < 0)
+        {
+            return;
+        }
+
+        InputEvent inputEvent = {};
+        inputEvent.Timestamp = timestamp;
+        inputEvent.Type = type;
+        inputEvent.PlayerIndex = static_cast<Uint8>(playerIndex);
+        inputEvent.Code = static_cast<Sint16>(code);
+        inputEvent.Down = down;
+        _events.Push(inputEvent);
+    }
+
+    /* ==== Latency ==== */
+
+    void SDLInputHandlerPlugin::SetLatencyTracking(bool enabled)
+    {
+        _trackLatency = enabled;
+        _unreadDevices = 0;
+    }
+
+    bool SDLInputHandlerPlugin::IsLatencyTracking() const
+    {
+        return _trackLatency;
+    }
+
+    const LatencyHistogram& SDLInputHandlerPlugin::GetInputLatency(InputDevice device, LatencyStage stage) const
+    {
+        return _latency[GetLatencyIndex(device, stage)];
+    }
+
+    void SDLInputHandlerPlugin::ResetInputLatency()
+    {
+        for (LatencyHistogram& histogram : _latency)
+        {
+            histogram.Reset();
+        }
+    }
+
+    size_t SDLInputHandlerPlugin::GetLatencyIndex(InputDevice device, LatencyStage stage)
+    {
+        return static_cast<size_t>(device) * static_cast<size_t>(LatencyStage::Count) + static_cast<size_t>(stage);
+    }
+
+    void SDLInputHandlerPlugin::MeasureVisibleLatency()
+    {
+        // Replayed events carry the timestamps of the recording session.
+        _unreadDevices = 0;
+        if (!_trackLatency || _replay.IsOpen())
+        {
+            return;
+        }
+
+        const Uint64 now = SDL_GetTicksNS();
+        for (size_t i = 0; i < _events.GetFrameCount(); ++i)
+        {
+            const InputEvent& inputEvent = _events.GetFrameItem(i);
+            const InputDevice device = GetEventDevice(inputEvent.Type);
+            _latency[GetLatencyIndex(device, LatencyStage::Visible)].Add(now > inputEvent.Timestamp ? now - inputEvent.Timestamp : 0);
+            _unreadDevices |= static_cast<Uint8>(1u << static_cast<Uint8>(device));
+        }
+    }
+
+    void SDLInputHandlerPlugin::NoteRead(InputDevice device) const
+    {
+        // Only the first read of a device after an Update with new events is measured.
+        const Uint8 bit = static_cast<Uint8>(1u << static_cast<Uint8>(device));
+        if ((_unreadDevices & bit) == 0)
+        {
+            return;
+        }
+        _unreadDevices &= static_cast<Uint8>(~bit);
+
+        const Uint64 now = SDL_GetTicksNS();
+        LatencyHistogram& histogram = _latency[GetLatencyIndex(device, LatencyStage::Consumed)];
+        for (size_t i = 0; i < _events.GetFrameCount(); ++i)
+        {
+            const InputEvent& inputEvent = _events.GetFrameItem(i);
+            if (GetEventDevice(inputEvent.Type) == device)
+            {
+                histogram.Add(now > inputEvent.Timestamp ? now - inputEvent.Timestamp : 0);
+            }
+        }
+    }
+
+    void SDLInputHandlerPlugin::NoteActionRead() const
+    {
+        // Actions may be bound to any device.
+        if (_unreadDevices != 0)
+        {
+            NoteRead(InputDevice::Keyboard);
+            NoteRead(InputDevice::Mouse);
+            NoteRead(InputDevice::Gamepad);
+        }
+    }
+
+    /* ==== Sampling ==== */
+
+    void SDLInputHandlerPlugin::StartSampling(int rateHz)
+    {
+        if (_replay.IsOpen())
+        {
+            TBX_TRACE_WARNING("SD3Input: Cannot sample gamepads while a replay is running.");
+            return;
+        }
+        _sampler.Start(rateHz);
+    }
+
+    void SDLInputHandlerPlugin::StopSampling()
+    {
+        _sampler.Stop();
+    }
+
+    bool SDLInputHandlerPlugin::IsSampling() const
+    {
+        return _sampler.IsRunning();
+    }
+
+    const InputSnapshot& SDLInputHandlerPlugin::GetLatestSnapshot()
+    {
+        return _sampler.Acquire();
+    }
+
+    /* ==== Recording ==== */
+
+    bool SDLInputHandlerPlugin::StartRecording(const std::filesystem::path& path)
+    {
+        if (_replay.IsOpen())
+        {
+            TBX_TRACE_WARNING("SD3Input: Cannot record input while a replay is running.");
+            return false;
+        }
+
+        if (!_recorder.Open(path))
+        {
+            return false;
+        }
+
+        WriteSnapshot();
+        TBX_TRACE_INFO("SD3Input: Recording input to '{}'.", path.string());
+        return true;
+    }
+
+    void SDLInputHandlerPlugin::StopRecording()
+    {
+        _recorder.Close();
+    }
+
+    bool SDLInputHandlerPlugin::IsRecording() const
+    {
+        return _recorder.IsOpen();
+    }
+
+    bool SDLInputHandlerPlugin::StartReplay(const std::filesystem::path& path)
+    {
+        if (_recorder.IsOpen())
+        {
+            TBX_TRACE_WARNING("SD3Input: Cannot replay input while recording.");
+            return false;
+        }
+
+        InputReplay replay = {};
+        if (!replay.Open(path))
+        {
+            return false;
+        }
+
+        // Start from a blank slate; the log opens with a snapshot of the recorded state.
+        StopSampling();
+        CloseGamepads();
+        _liveInput = {};
+        _liveAxes = {};
+        _livePressedAny = {};
+        _liveReleasedAny = {};
+        _mousePos = { 0, 0 };
+        _mouseDelta = { 0, 0 };
+        _replay = std::move(replay);
+        TBX_TRACE_INFO("SD3Input: Replaying input from '{}'.", path.string());
+        return true;
+    }
+
+    void SDLInputHandlerPlugin::StopReplay()
+    {
+        if (!_replay.IsOpen())
+        {
+            return;
+        }
+
+        // Hand control back to the devices as they are now.
+        _replay.Close();
+        for (GamepadSlot& gamepad : _gamepads)
+        {
+            gamepad.Connected = false;
+        }
+        _liveInput = {};
+        _liveAxes = {};
+        _hasMouseState = false;
+        InitGamepads();
+        SeedKeyboard();
+        SeedMouse();
+        TBX_TRACE_INFO("SD3Input: Input replay finished.");
+    }
+
+    bool SDLInputHandlerPlugin::IsReplaying() const
+    {
+        return _replay.IsOpen();
+    }
+
+    void SDLInputHandlerPlugin::Submit(const InputRecord& record)
+    {
+        if (_recorder.IsOpen())
+        {
+            _recorder.Write(record);
+        }
+        ApplyRecord(record);
+    }
+
+    void SDLInputHandlerPlugin::ApplyRecord(const InputRecord& record)
+    {
+        switch (record.Type)
+        {
+            case InputRecordType::Frame:
+                break;
+            case InputRecordType::Key:
+            {
+                if (record.Code >= SDL_SCANCODE_COUNT) break;
+                const size_t bit = KeyBit(record.Code);
+                SetBit(_liveInput, bit, record.Down);
+                RecordTransition(bit, InputEventType::Key, 0, ConvertScancode(static_cast<SDL_Scancode>(record.Code)), record.Down, record.Timestamp);
+                break;
+            }
+            case InputRecordType::MouseButton:
+            {
+                if (record.Code == 0 || record.Code > 32) break;
+                SetBit(_liveInput, MouseBit(record.Code), record.Down);
+                RecordTransition(MouseBit(record.Code), InputEventType::MouseButton, 0, ConvertSDLMouseButton(static_cast<uint8_t>(record.Code)), record.Down, record.Timestamp);
+                break;
+            }
+            case InputRecordType::MouseState:
+            {
+                _liveInput[MouseWord] = record.MouseButtons;
+                _mousePos = Vector2(record.MouseX, record.MouseY);
+                _mouseDelta = Vector2(record.MouseDeltaX, record.MouseDeltaY);
+                break;
+            }
+            case InputRecordType::GamepadButton:
+            {
+                const int slot = GetConnectedSlot(record.Slot);
+                if (slot < 0 || record.Code >= SDL_GAMEPAD_BUTTON_COUNT) break;
+                const size_t bit = GamepadBit(slot, record.Code);
+                SetBit(_liveInput, bit, record.Down);
+                RecordTransition(bit, InputEventType::GamepadButton, slot, ConvertSDLGamepadButton(static_cast<SDL_GamepadButton>(record.Code)), record.Down, record.Timestamp);
+                break;
+            }
+            case InputRecordType::GamepadAxis:
+            {
+                const int slot = GetConnectedSlot(record.Slot);
+                float* value = slot >= 0 ? FindAxis(_liveAxes, slot, record.Code) : nullptr;
+                if (value == nullptr) break;
+                // Convert the axis value from the range [-32768, 32767] to [-1, 1]
+                *value = static_cast<float>(record.AxisValue) / 32768.0f;
+                break;
+            }
+            case InputRecordType::GamepadConnection:
+            {
+                if (record.Slot >= MaxGamepads) break;
+                // Clearing the slot's word reports any held buttons as released next frame.
+                GamepadSlot& gamepad = _gamepads[record.Slot];
+                gamepad.Connected = record.Down;
+                ClearSlotAxes(_liveAxes, record.Slot);
+                ClearSlotAxes(_axes, record.Slot);
+                _liveInput[GamepadWord + record.Slot] = 0;
+                break;
+            }
+        }
+    }
+
+    void SDLInputHandlerPlugin::ReplayFrame()
+    {
+        InputRecord record = {};
+        while (_replay.Next(record))
+        {
+            if (record.Type == InputRecordType::Frame)
+            {
+                return;
+            }
+            ApplyRecord(record);
+        }
+
+        StopReplay();
+    }
+
+    void SDLInputHandlerPlugin::WriteSnapshot()
+    {
+        // Opens a log with the state held right now, so replay starts where recording did.
+        for (int slot = 0; slot < MaxGamepads; ++slot)
+        {
+            if (!_gamepads[slot].Connected) continue;
+
+            InputRecord connection = {};
+            connection.Type = InputRecordType::GamepadConnection;
+            connection.Slot = static_cast<Uint8>(slot);
+            connection.Down = true;
+            _recorder.Write(connection);
+
+            for (int b = 0; b < SDL_GAMEPAD_BUTTON_COUNT; ++b)
+            {
+                if (!TestBit(_liveInput, GamepadBit(slot, b))) continue;
+                InputRecord button = {};
+                button.Type = InputRecordType::GamepadButton;
+                button.Slot = static_cast<Uint8>(slot);
+                button.Code = static_cast<Uint16>(b);
+                button.Down = true;
+                _recorder.Write(button);
+            }
+
+            for (int a = 0; a < SDL_GAMEPAD_AXIS_COUNT; ++a)
+            {
+                InputRecord axis = {};
+                axis.Type = InputRecordType::GamepadAxis;
+                axis.Slot = static_cast<Uint8>(slot);
+                axis.Code = static_cast<Uint16>(a);
+                axis.AxisValue = static_cast<Sint16>(std::clamp(std::lround(ReadAxis(_liveAxes, slot, a) * 32768.0f), -32768l, 32767l));
+                _recorder.Write(axis);
+            }
+        }
 
-        auto* gamepad = _gamepads.find(playerIndex)->second;
-        const auto axisVal = SDL_GetGamepadAxis(gamepad, sdlAxis);
+        for (int sc = 0; sc < SDL_SCANCODE_COUNT; ++sc)
+        {
+            if (!TestBit(_liveInput, KeyBit(sc))) continue;
+            InputRecord key = {};
+            key.Type = InputRecordType::Key;
+            key.Code = static_cast<Uint16>(sc);
+            key.Down = true;
+            _recorder.Write(key);
+        }
+
+        // Force the next Update to log the mouse.
+        _hasMouseState = false;
+    }
 
-        // Convert the axis value from the range [-32768, 32767] to [-1, 1]
-        const float normalized = (float)axisVal / 32768.0f;
+    void SDLInputHandlerPlugin::SeedMouse()
+    {
+        // Like keys, buttons and position follow events once seeded.
+        float x, y;
+        _liveInput[MouseWord] = SDL_GetMouseState(&x, &y);
+        _mouseMotion.SetPosition(x, y);
+    }
 
-        return normalized;
+    void SDLInputHandlerPlugin::SeedKeyboard()
+    {
+        // Key state is tracked from events from here on; pick up anything already held.
+        int keyCount = 0;
+        const bool* keyboardState = SDL_GetKeyboardState(&keyCount);
+        for (int sc = 0; keyboardState && sc < keyCount && sc < SDL_SCANCODE_COUNT; ++sc)
+        {
+            SetBit(_liveInput, KeyBit(sc), keyboardState[sc]);
+        }
     }
 
     bool SDLInputHandlerPlugin::OnSDLEvent(SDL_Event* event)
     {
+        // The sampler's device updates call the event watch on its own thread. All plugin
+        // state belongs to the game thread, so those events wait for the next Update.
+        if (InputSampler::IsSamplerThread())
+        {
+            _sampler.GetEvents().Push(*event);
+            return false;
+        }
+        return HandleSDLEvent(event);
+    }
+
+    bool SDLInputHandlerPlugin::HandleSDLEvent(SDL_Event* event)
+    {
+        // A replay owns all input state until it ends.
+        if (_replay.IsOpen())
+        {
+            return false;
+        }
+
+        // Motion comes first: high polling rate mice deliver thousands of these per second,
+        // and each only adds to the frame's totals.
+        if (event->type == SDL_EVENT_MOUSE_MOTION)
+        {
+            const SDL_MouseMotionEvent& motion = event->motion;
+            _mouseMotion.AddMotion(motion.timestamp, motion.x, motion.y, motion.xrel, motion.yrel);
+            return false;
+        }
+
         switch (event->type)
         {
             case SDL_EVENT_JOYSTICK_ADDED:
             {
                 auto id = event->jdevice.which;
-                RegisterGamepad(id);
+                QueueGamepadOpen(id);
                 TBX_TRACE_INFO("SD3Input: Gamepad {} detected!", id);
                 break;
             }
             case SDL_EVENT_JOYSTICK_REMOVED:
             {
-                int id = event->jdevice.which;
+                auto id = event->jdevice.which;
+                const auto queuedEnd = _queuedOpens.begin() + _queuedOpenCount;
+                _queuedOpenCount = static_cast<size_t>(std::remove(_queuedOpens.begin(), queuedEnd, id) - _queuedOpens.begin());
                 CloseGamepad(id);
                 TBX_TRACE_INFO("SD3Input: Gamepad {} disconnected.", id);
                 break;
             }
+            case SDL_EVENT_KEY_DOWN:
+            case SDL_EVENT_KEY_UP:
+            {
+                // Repeats carry no transition, so they are neither applied nor recorded.
+                if (event->key.repeat) break;
+                InputRecord record = {};
+                record.Type = InputRecordType::Key;
+                record.Code = static_cast<Uint16>(event->key.scancode);
+                record.Down = event->key.down;
+                record.Timestamp = event->key.timestamp;
+                Submit(record);
+                break;
+            }
+            case SDL_EVENT_MOUSE_BUTTON_DOWN:
+            case SDL_EVENT_MOUSE_BUTTON_UP:
+            {
+                InputRecord record = {};
+                record.Type = InputRecordType::MouseButton;
+                record.Code = event->button.button;
+                record.Down = event->button.down;
+                record.Timestamp = event->button.timestamp;
+                Submit(record);
+                break;
+            }
+            case SDL_EVENT_GAMEPAD_BUTTON_DOWN:
+            case SDL_EVENT_GAMEPAD_BUTTON_UP:
+            {
+                const int slot = FindGamepadSlot(event->gbutton.which);
+                if (slot < 0) break;
+                InputRecord record = {};
+                record.Type = InputRecordType::GamepadButton;
+                record.Slot = static_cast<Uint8>(slot);
+                record.Code = event->gbutton.button;
+                record.Down = event->gbutton.down;
+                record.Timestamp = event->gbutton.timestamp;
+                Submit(record);
+                break;
+            }
+            case SDL_EVENT_GAMEPAD_AXIS_MOTION:
+            {
+                const int slot = FindGamepadSlot(event->gaxis.which);
+                if (slot < 0) break;
+                InputRecord record = {};
+                record.Type = InputRecordType::GamepadAxis;
+                record.Slot = static_cast<Uint8>(slot);
+                record.Code = event->gaxis.axis;
+                record.AxisValue = event->gaxis.value;
+                Submit(record);
+                break;
+            }
+            case SDL_EVENT_GAMEPAD_SENSOR_UPDATE:
+            {
+                const int slot = FindGamepadSlot(event->gsensor.which);
+                if (slot < 0) break;
+                MotionSample sample = {};
+                sample.Timestamp = event->gsensor.sensor_timestamp != 0 ? event->gsensor.sensor_timestamp : event->gsensor.timestamp;
+                sample.X = event->gsensor.data[0];
+                sample.Y = event->gsensor.data[1];
+                sample.Z = event->gsensor.data[2];
+                if (event->gsensor.sensor == SDL_SENSOR_GYRO)
+                {
+                    _sensors[slot].Gyro.Push(sample);
+                }
+                else if (event->gsensor.sensor == SDL_SENSOR_ACCEL)
+                {
+                    _sensors[slot].Accel.Push(sample);
+                }
+                break;
+            }
+            case SDL_EVENT_GAMEPAD_TOUCHPAD_DOWN:
+            case SDL_EVENT_GAMEPAD_TOUCHPAD_MOTION:
+            case SDL_EVENT_GAMEPAD_TOUCHPAD_UP:
+            {
+                const int slot = FindGamepadSlot(event->gtouchpad.which);
+                if (slot < 0) break;
+                TouchSample sample = {};
+                sample.Timestamp = event->gtouchpad.timestamp;
+                sample.Touchpad = static_cast<Uint8>(event->gtouchpad.touchpad);
+                sample.Finger = static_cast<Uint8>(event->gtouchpad.finger);
+                sample.Down = event->type != SDL_EVENT_GAMEPAD_TOUCHPAD_UP;
+                sample.X = event->gtouchpad.x;
+                sample.Y = event->gtouchpad.y;
+                sample.Pressure = event->gtouchpad.pressure;
+                _sensors[slot].Touch.Push(sample);
+                break;
+            }
             default:
                 break;
         }
@@ -210,49 +951,217 @@ namespace Tbx::Plugins::SDLInput
         return false;
     }
 
-    void SDLInputHandlerPlugin::CloseGamepad(int id)
+    void SDLInputHandlerPlugin::CloseGamepad(SDL_JoystickID id)
+    {
+        const int slot = FindGamepadSlot(id);
+        if (slot < 0)
+        {
+            return;
+        }
+
+        // The sampler must let go of the handle before it is closed.
+        _sampler.SetGamepad(slot, nullptr);
+        SDL_CloseGamepad(_gamepads[slot].Handle);
+        _gamepads[slot].Handle = nullptr;
+        _gamepads[slot].Id = 0;
+
+        InputRecord record = {};
+        record.Type = InputRecordType::GamepadConnection;
+        record.Slot = static_cast<Uint8>(slot);
+        record.Down = false;
+        Submit(record);
+    }
+
+    int SDLInputHandlerPlugin::FindGamepadSlot(SDL_JoystickID id) const
     {
-        const auto it = _gamepads.find(id);
-        if (it != _gamepads.end() && it->second)
+        for (int slot = 0; slot < MaxGamepads; ++slot)
         {
-            SDL_CloseGamepad(it->second);
-            _gamepads.erase(it);
-            _currGamepadBtnState.erase(id);
-            _prevGamepadBtnState.erase(id);
+            if (_gamepads[slot].Handle != nullptr && _gamepads[slot].Id == id)
+            {
+                return slot;
+            }
         }
+        return -1;
+    }
+
+    int SDLInputHandlerPlugin::GetButtonSlot(int playerIndex)
+    {
+        // Button queries do not require a connected pad: a disconnect clears the slot's bits,
+        // and the release edges that leaves must stay visible for the frame after.
+        return playerIndex >= 0 && playerIndex < MaxGamepads ? playerIndex : -1;
+    }
+
+    int SDLInputHandlerPlugin::GetConnectedSlot(int playerIndex) const
+    {
+        if (playerIndex < 0 || playerIndex >= MaxGamepads || !_gamepads[playerIndex].Connected)
+        {
+            return -1;
+        }
+        return playerIndex;
     }
 
     void SDLInputHandlerPlugin::InitGamepads()
     {
         int numGamepads = 0;
         auto* gp = SDL_GetGamepads(&numGamepads);
-        if (gp == nullptr || numGamepads == 0)
+        if (gp == nullptr)
         {
             return;
         }
 
         for (int i = 0; i < numGamepads; ++i)
         {
-            RegisterGamepad(*gp);
-            gp++;
+            RegisterGamepad(gp[i]);
+        }
+        SDL_free(gp);
+    }
+
+    void SDLInputHandlerPlugin::QueueGamepadOpen(SDL_JoystickID id)
+    {
+        // Joysticks that are not gamepads are never opened.
+        if (!SDL_IsGamepad(id) || _queuedOpenCount == _queuedOpens.size())
+        {
+            return;
+        }
+        _queuedOpens[_queuedOpenCount++] = id;
+    }
+
+    void SDLInputHandlerPlugin::OpenQueuedGamepads()
+    {
+        for (size_t i = 0; i < _queuedOpenCount; ++i)
+        {
+            RegisterGamepad(_queuedOpens[i]);
+        }
+        _queuedOpenCount = 0;
+    }
+
+    int SDLInputHandlerPlugin::ChooseGamepadSlot(Uint64 identity, int preferredSlot) const
+    {
+        // A returning pad gets its old slot back.
+        for (int slot = 0; slot < MaxGamepads; ++slot)
+        {
+            const GamepadSlot& gamepad = _gamepads[slot];
+            if (gamepad.Handle == nullptr && gamepad.Identity == identity)
+            {
+                return slot;
+            }
+        }
+
+        // Then the player index SDL assigned, then the first slot nobody has claimed.
+        if (preferredSlot >= 0 && preferredSlot < MaxGamepads
+            && _gamepads[preferredSlot].Handle == nullptr && _gamepads[preferredSlot].Identity == 0)
+        {
+            return preferredSlot;
+        }
+        for (int slot = 0; slot < MaxGamepads; ++slot)
+        {
+            if (_gamepads[slot].Handle == nullptr && _gamepads[slot].Identity == 0)
+            {
+                return slot;
+            }
+        }
+
+        // With every slot claimed, take over the reservation of a disconnected pad.
+        for (int slot = 0; slot < MaxGamepads; ++slot)
+        {
+            if (_gamepads[slot].Handle == nullptr)
+            {
+                return slot;
+            }
+        }
+        return -1;
+    }
+
+    bool SDLInputHandlerPlugin::IsGamepadConnected(int playerIndex) const
+    {
+        return GetConnectedSlot(playerIndex) >= 0;
+    }
+
+    void SDLInputHandlerPlugin::ReleasePlayerSlot(int playerIndex)
+    {
+        if (playerIndex >= 0 && playerIndex < MaxGamepads && _gamepads[playerIndex].Handle == nullptr)
+        {
+            _gamepads[playerIndex].Identity = 0;
         }
     }
 
     void SDLInputHandlerPlugin::RegisterGamepad(SDL_JoystickID gp)
     {
+        if (FindGamepadSlot(gp) >= 0)
+        {
+            return;
+        }
+
         auto* gamepad = SDL_OpenGamepad(gp);
-        auto playerIndex = SDL_GetGamepadPlayerIndex(gamepad);
-        _gamepads[playerIndex] = gamepad;
+        if (gamepad == nullptr)
+        {
+            return;
+        }
+
+        // 64-bit FNV-1a over the GUID and, where the pad reports one, its serial.
+        Uint64 identity = 0xcbf29ce484222325ull;
+        const SDL_GUID guid = SDL_GetGamepadGUIDForID(gp);
+        for (const Uint8 byte : guid.data)
+        {
+            identity = (identity ^ byte) * 0x100000001b3ull;
+        }
+        for (const char* serial = SDL_GetGamepadSerial(gamepad); serial != nullptr && *serial != '\0'; ++serial)
+        {
+            identity = (identity ^ static_cast<Uint8>(*serial)) * 0x100000001b3ull;
+        }
+
+        const int slot = ChooseGamepadSlot(identity, SDL_GetGamepadPlayerIndex(gamepad));
+        if (slot < 0)
+        {
+            TBX_TRACE_WARNING("SD3Input: Ignoring gamepad {}, all {} slots are in use.", gp, MaxGamepads);
+            SDL_CloseGamepad(gamepad);
+            return;
+        }
+        SDL_SetGamepadPlayerIndex(gamepad, slot);
+
+        _gamepads[slot].Handle = gamepad;
+        _gamepads[slot].Id = gp;
+        _gamepads[slot].Identity = identity;
+        _sampler.SetGamepad(slot, gamepad);
+        _sensors[slot].Clear();
+        EnableMotionSensors(gamepad, _motionSensorsEnabled);
+
+        InputRecord connection = {};
+        connection.Type = InputRecordType::GamepadConnection;
+        connection.Slot = static_cast<Uint8>(slot);
+        connection.Down = true;
+        Submit(connection);
+
+        // Events only report changes, so seed the state once from the device.
+        for (int b = 0; b < SDL_GAMEPAD_BUTTON_COUNT; ++b)
+        {
+            if (!SDL_GetGamepadButton(gamepad, static_cast<SDL_GamepadButton>(b))) continue;
+            InputRecord button = {};
+            button.Type = InputRecordType::GamepadButton;
+            button.Slot = static_cast<Uint8>(slot);
+            button.Code = static_cast<Uint16>(b);
+            button.Down = true;
+            Submit(button);
+        }
+        for (int a = 0; a < SDL_GAMEPAD_AXIS_COUNT; ++a)
+        {
+            InputRecord axis = {};
+            axis.Type = InputRecordType::GamepadAxis;
+            axis.Slot = static_cast<Uint8>(slot);
+            axis.Code = static_cast<Uint16>(a);
+            axis.AxisValue = SDL_GetGamepadAxis(gamepad, static_cast<SDL_GamepadAxis>(a));
+            Submit(axis);
+        }
     }
 
     void SDLInputHandlerPlugin::CloseGamepads()
     {
-        for (const auto& [id, gamepad] : _gamepads)
+        for (int slot = 0; slot < MaxGamepads; ++slot)
         {
-            SDL_CloseGamepad(gamepad);
-            _currGamepadBtnState.erase(id);
-            _prevGamepadBtnState.erase(id);
+            if (_gamepads[slot].Handle != nullptr)
+            {
+                CloseGamepad(_gamepads[slot].Id);
+            }
         }
-        _gamepads.clear();
     }
 }
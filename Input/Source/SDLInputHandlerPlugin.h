@@ -1,4 +1,15 @@
 #pragma once
+#include "SDLInputActions.h"
+#include "SDLInputAxes.h"
+#include "SDLInputBitset.h"
+#include "SDLInputEventBuffer.h"
+#include "SDLInputEvents.h"
+#include "SDLInputRecording.h"
+#include "SDLInputLatency.h"
+#include "SDLInputMouse.h"
+#include "SDLInputSampler.h"
+#include "SDLInputSensors.h"
+#include "Tbx/Events/EventCarrier.h"
 #include "Tbx/Input/IInputHandler.h"
 #include "Tbx/Plugins/Plugin.h"
 #include <SDL3/SDL_events.h>
@@ -7,10 +18,31 @@
 #include <SDL3/SDL_scancode.h>
 #include <SDL3/SDL_stdinc.h>
 #include <array>
-#include <unordered_map>
+#include <filesystem>
+#include <span>
+#include <string_view>
+#include <vector>
 
 namespace Tbx::Plugins::SDLInput
 {
+	// A player's gamepad. Its buttons and axes live in the flat input arrays under the same slot.
+	struct GamepadSlot
+	{
+		SDL_Gamepad* Handle = nullptr;
+		SDL_JoystickID Id = 0;
+		// Hash of the pad's GUID and serial. Kept after a disconnect so the same pad gets its
+		// slot back when it reconnects.
+		Uint64 Identity = 0;
+		// Follows the input stream rather than the handle, so replayed pads count as connected.
+		bool Connected = false;
+	};
+
+	struct KeyChange
+	{
+		int Key = -1;
+		bool Pressed = false;
+	};
+
 	class SDLInputHandlerPlugin final
 		: public Plugin
 		, public IInputHandler
@@ -24,36 +56,190 @@ namespace Tbx::Plugins::SDLInput
 		bool IsGamepadButtonDown(int playerIndex, int button) const override;
 		bool IsGamepadButtonUp(int playerIndex, int button) const override;
 		bool IsGamepadButtonHeld(int playerIndex, int button) const override;
+		// Player indices are stable: a slot stays reserved for its pad after a disconnect
+		// until the pad returns or the slot is released, and new pads take unreserved slots
+		// first.
+		bool IsGamepadConnected(int playerIndex) const;
+		void ReleasePlayerSlot(int playerIndex);
+
+		// Returns the axis as filtered by the current AxisFilterSettings at the last Update.
 		float GetGamepadAxis(int playerIndex, int axis) const override;
+		// The axis as last reported by the device, without deadzones or curves.
+		float GetRawGamepadAxis(int playerIndex, int axis) const;
+		// Applies to every gamepad from the next Update.
+		void SetAxisFilter(const AxisFilterSettings& settings);
+		const AxisFilterSettings& GetAxisFilter() const;
 
 		bool IsKeyDown(int keyCode) const override;
 		bool IsKeyUp(int keyCode) const override;
 		bool IsKeyHeld(int keyCode) const override;
 
+		// Fills changes with every key pressed or released this frame, as TBX key codes, and
+		// returns how many were written. Keys without a TBX code are skipped.
+		size_t GetChangedKeys(std::span<KeyChange> changes) const;
+
 		bool IsMouseButtonDown(int button) const override;
 		bool IsMouseButtonUp(int button) const override;
 		bool IsMouseButtonHeld(int button) const override;
 		Vector2 GetMousePosition() const override;
+		// Sum of every motion event since the previous Update, at sub-pixel precision.
 		Vector2 GetMouseDelta() const override;
+		// When enabled, every motion event of the last frame is kept with its timestamp, for
+		// aim smoothing that needs the path rather than the total. Off by default.
+		void SetMouseMotionPathEnabled(bool enabled);
+		size_t GetMouseMotionPath(std::span<MouseMotionSample> samples) const;
+
+		// True if the input went down, or up, at any point this frame, even when it was
+		// released again before Update and so never showed up in the snapshot.
+		bool WasKeyPressed(int keyCode) const;
+		bool WasKeyReleased(int keyCode) const;
+		bool WasMouseButtonPressed(int button) const;
+		bool WasMouseButtonReleased(int button) const;
+		bool WasGamepadButtonPressed(int playerIndex, int button) const;
+		bool WasGamepadButtonReleased(int playerIndex, int button) const;
+
+		// Copies every gyro, accelerometer or touchpad sample the pad delivered during the
+		// last frame, oldest first, and returns how many were written. Samples arrive at the
+		// controller's own rate, so a frame may hold many or none.
+		size_t GetGyroSamples(int playerIndex, std::span<MotionSample> samples) const;
+		size_t GetAccelSamples(int playerIndex, std::span<MotionSample> samples) const;
+		size_t GetTouchpadSamples(int playerIndex, std::span<TouchSample> samples) const;
+		// Native gyro rate of the pad in Hz, or zero when it has no gyro.
+		float GetMotionSensorRate(int playerIndex) const;
+		// Motion sensors cost controller bandwidth and battery, so they can be switched off.
+		// Enabled by default; applies to connected and future pads.
+		void SetMotionSensorsEnabled(bool enabled);
+
+		// Actions bind names to any mix of keys, mouse buttons and gamepad buttons and axes.
+		// All actions are resolved once per Update, so queries are plain lookups by index.
+		// Rebinding takes effect at the next Update.
+		int AddAction(std::string_view name);
+		int FindAction(std::string_view name) const;
+		bool BindAction(int action, const ActionBinding& binding);
+		void ClearActionBindings(int action);
+		bool IsActionDown(int action) const;
+		bool WasActionPressed(int action) const;
+		bool WasActionReleased(int action) const;
+		float GetActionValue(int action) const;
+
+		// Every key, mouse button and gamepad button transition of this frame, in the order
+		// SDL delivered them.
+		size_t GetFrameEventCount() const;
+		const InputEvent& GetFrameEvent(size_t index) const;
+
+		// When enabled, Update posts one InputChangedEvent per frame with input changes.
+		// Enabled by default.
+		void SetInputEventsEnabled(bool enabled);
+
+		// Writes every input change, one frame per Update, to a compact binary log.
+		bool StartRecording(const std::filesystem::path& path);
+		void StopRecording();
+		bool IsRecording() const;
+
+		// Drives input from a recorded log instead of SDL, one recorded frame per Update,
+		// until the log ends. No input devices are involved, so sessions can be replayed
+		// headlessly under SDL's dummy video driver.
+		bool StartReplay(const std::filesystem::path& path);
+		void StopReplay();
+		bool IsReplaying() const;
+
+		// Measures how long key, mouse button and gamepad button transitions take from their
+		// SDL event timestamp to becoming visible in Update, and to the first query of that
+		// device afterwards. Off by default; queries only test a flag while it is off.
+		void SetLatencyTracking(bool enabled);
+		bool IsLatencyTracking() const;
+		const LatencyHistogram& GetInputLatency(InputDevice device, LatencyStage stage) const;
+		void ResetInputLatency();
+
+		// Polls gamepads on a background thread at rateHz, independent of the frame rate.
+		// GetLatestSnapshot then returns the freshest sample without blocking, for code that
+		// wants gamepad state later than Update. The gamepad events each poll raises are
+		// queued and applied at the next Update, so Update sees every transition at the
+		// sampling rate. Sampling reflects the devices, so it is stopped by StartReplay.
+		void StartSampling(int rateHz = 1000);
+		void StopSampling();
+		bool IsSampling() const;
+		const InputSnapshot& GetLatestSnapshot();
 
 		bool OnSDLEvent(SDL_Event* event);
 
 	private:
+		// Every input change, live or replayed, is applied through here.
+		bool HandleSDLEvent(SDL_Event* event);
+		void Submit(const InputRecord& record);
+		void ApplyRecord(const InputRecord& record);
+		void ReplayFrame();
+		void WriteSnapshot();
+		void SeedKeyboard();
+		void SeedMouse();
+		void PostInputChanges();
+		void MeasureVisibleLatency();
+		void NoteRead(InputDevice device) const;
+		void NoteActionRead() const;
+		static size_t GetLatencyIndex(InputDevice device, LatencyStage stage);
+		void RecordTransition(size_t bit, InputEventType type, int playerIndex, int code, bool down, Uint64 timestamp);
 		void InitGamepads();
+		void QueueGamepadOpen(SDL_JoystickID id);
+		void OpenQueuedGamepads();
 		void RegisterGamepad(SDL_JoystickID gp);
+		int ChooseGamepadSlot(Uint64 identity, int preferredSlot) const;
 		void CloseGamepads();
-		void CloseGamepad(int id);
+		void CloseGamepad(SDL_JoystickID id);
+		void EnableMotionSensors(SDL_Gamepad* gamepad, bool enabled);
+		int FindGamepadSlot(SDL_JoystickID id) const;
+		int GetConnectedSlot(int playerIndex) const;
+		static int GetButtonSlot(int playerIndex);
+
+		// Slots are indexed by player index; gamepads without one are given a free slot.
+		std::array<GamepadSlot, MaxGamepads> _gamepads = {};
+		// Hotplugged pads are opened at the next Update rather than inside the event watch.
+		std::array<SDL_JoystickID, MaxGamepads> _queuedOpens = {};
+		size_t _queuedOpenCount = 0;
+
+		InputActionMap _actions = {};
+
+		// Indexed by slot, like _gamepads. Sensors are not recorded or replayed.
+		std::array<GamepadSensorStreams, MaxGamepads> _sensors = {};
+		bool _motionSensorsEnabled = true;
+
+		// Raw axes follow events; Update filters them all in one pass into _axes.
+		GamepadAxes _liveAxes = {};
+		GamepadAxes _axes = {};
+		AxisFilterSettings _axisFilter = {};
+
+		// Live bits follow events as they arrive; Update rolls them into the frame snapshot.
+		InputBits _liveInput = {};
+		InputBits _currInput = {};
+		InputBits _prevInput = {};
+		InputBits _pressedInput = {};
+		InputBits _releasedInput = {};
+
+		// Every transition seen by the event watch, accumulated until the next Update.
+		InputBits _livePressedAny = {};
+		InputBits _liveReleasedAny = {};
+		InputBits _pressedAny = {};
+		InputBits _releasedAny = {};
+		InputEventBuffer _events = {};
+
+		// The frame's transitions, made contiguous for InputChangedEvent. Reserved up front so
+		// publishing never allocates.
+		EventCarrier _eventCarrier = {};
+		std::vector<InputEvent> _publishedEvents = {};
+		bool _publishEvents = true;
 
-		std::unordered_map<int, SDL_Gamepad*> _gamepads = {};
+		InputSampler _sampler = {};
 
-		std::unordered_map<int, std::array<bool, SDL_GAMEPAD_BUTTON_COUNT>> _currGamepadBtnState;
-		std::unordered_map<int, std::array<bool, SDL_GAMEPAD_BUTTON_COUNT>> _prevGamepadBtnState;
+		// Queries are const but record when they first see a frame's events.
+		bool _trackLatency = false;
+		mutable Uint8 _unreadDevices = 0;
+		mutable std::array<LatencyHistogram, static_cast<size_t>(InputDevice::Count) * static_cast<size_t>(LatencyStage::Count)> _latency = {};
 
-		std::array<Uint8, SDL_SCANCODE_COUNT> _currKeyState{};
-		std::array<Uint8, SDL_SCANCODE_COUNT> _prevKeyState{};
+		InputRecorder _recorder = {};
+		InputReplay _replay = {};
+		InputRecord _lastMouseState = {};
+		bool _hasMouseState = false;
 
-		Uint32 _currMouseState = 0;
-		Uint32 _prevMouseState = 0;
+		MouseMotionAccumulator _mouseMotion = {};
 		Vector2 _mouseDelta = { 0, 0 };
 		Vector2 _mousePos = { 0, 0 };
 	};
@@ -0,0 +1,105 @@
+#pragma once
+#include "SDLInputEventBuffer.h"
+#include <SDL3/SDL_stdinc.h>
+#include <array>
+
+namespace Tbx::Plugins::SDLInput
+{
+    enum class InputDevice : Uint8
+    {
+        Keyboard,
+        Mouse,
+        Gamepad,
+        Count
+    };
+
+    enum class LatencyStage : Uint8
+    {
+        // From the SDL event timestamp to the Update that made the input visible.
+        Visible,
+        // From the SDL event timestamp to the first query that read the device afterwards.
+        Consumed,
+        Count
+    };
+
+    inline InputDevice GetEventDevice(InputEventType type)
+    {
+        switch (type)
+        {
+            case InputEventType::Key: return InputDevice::Keyboard;
+            case InputEventType::MouseButton: return InputDevice::Mouse;
+            default: return InputDevice::Gamepad;
+        }
+    }
+
+    // Fixed histogram of latencies in 250 microsecond buckets up to 64 ms, with everything
+    // slower counted in the last bucket.
+    class LatencyHistogram
+    {
+    public:
+        static constexpr Uint64 BucketWidthNs = 250000;
+        static constexpr size_t BucketCount = 257;
+
+        void Add(Uint64 latencyNs)
+        {
+            const size_t bucket = static_cast<size_t>(latencyNs / BucketWidthNs);
+            _counts[bucket < BucketCount ? bucket : BucketCount - 1]++;
+            _total++;
+            _sumNs += latencyNs;
+            _maxNs = latencyNs > _maxNs ? latencyNs : _maxNs;
+        }
+
+        void Reset()
+        {
+            *this = {};
+        }
+
+        Uint64 GetCount() const
+        {
+            return _total;
+        }
+
+        Uint64 GetMaxNs() const
+        {
+            return _maxNs;
+        }
+
+        double GetAverageNs() const
+        {
+            return _total != 0 ? static_cast<double>(_sumNs) / static_cast<double>(_total) : 0.0;
+        }
+
+        // Upper edge of the bucket holding the given percentile, in [0, 100].
+        Uint64 GetPercentileNs(double percentile) const
+        {
+            if (_total == 0)
+            {
+                return 0;
+            }
+
+            const double clamped = percentile < 0.0 ? 0.0 : (percentile > 100.0 ? 100.0 : percentile);
+            const Uint64 target = static_cast<Uint64>(clamped / 100.0 * static_cast<double>(_total - 1)) + 1;
+            Uint64 seen = 0;
+            for (size_t i = 0; i < BucketCount; ++i)
+            {
+                seen += _counts[i];
+                if (seen >= target)
+                {
+                    return i == BucketCount - 1 ? _maxNs : (i + 1) * BucketWidthNs;
+                }
+            }
+            return _maxNs;
+        }
+
+        const std::array<Uint32, BucketCount>& GetBuckets() const
+        {
+            return _counts;
+        }
+
+    private:
+        std::array<Uint32, BucketCount> _counts = {};
+        Uint64 _total = 0;
+        Uint64 _sumNs = 0;
+        Uint64 _maxNs = 0;
+    };
+}
@@ -0,0 +1,81 @@
+#pragma once
+#include "SDLInputEventBuffer.h"
+#include <SDL3/SDL_stdinc.h>
+
+namespace Tbx::Plugins::SDLInput
+{
+    // One mouse motion event, at SDL's sub-pixel precision.
+    struct MouseMotionSample
+    {
+        Uint64 Timestamp = 0;
+        float X = 0.0f;
+        float Y = 0.0f;
+        float DeltaX = 0.0f;
+        float DeltaY = 0.0f;
+    };
+
+    // Sums mouse motion events between frames. Deltas are summed in double precision so
+    // thousands of sub-pixel steps per frame lose nothing. The timestamped path is only kept
+    // when enabled; under steady 8 kHz motion it has room for 512 samples a frame, so it holds
+    // every sample at frame rates down to about 16 Hz.
+    class MouseMotionAccumulator
+    {
+    public:
+        void AddMotion(Uint64 timestamp, float x, float y, float deltaX, float deltaY)
+        {
+            _x = x;
+            _y = y;
+            _deltaX += deltaX;
+            _deltaY += deltaY;
+            if (_keepPath)
+            {
+                _path.Push({ timestamp, x, y, deltaX, deltaY });
+            }
+        }
+
+        void SetPosition(float x, float y)
+        {
+            _x = x;
+            _y = y;
+        }
+
+        // Returns the motion since the last call and starts a new frame.
+        void EndFrame(float& x, float& y, float& deltaX, float& deltaY)
+        {
+            x = _x;
+            y = _y;
+            deltaX = static_cast<float>(_deltaX);
+            deltaY = static_cast<float>(_deltaY);
+            _deltaX = 0.0;
+            _deltaY = 0.0;
+            _path.EndFrame();
+        }
+
+        void SetPathEnabled(bool enabled)
+        {
+            _keepPath = enabled;
+            if (!enabled)
+            {
+                _path.Clear();
+            }
+        }
+
+        bool IsPathEnabled() const
+        {
+            return _keepPath;
+        }
+
+        const FrameRingBuffer<MouseMotionSample, 1024>& GetPath() const
+        {
+            return _path;
+        }
+
+    private:
+        float _x = 0.0f;
+        float _y = 0.0f;
+        double _deltaX = 0.0;
+        double _deltaY = 0.0;
+        bool _keepPath = false;
+        FrameRingBuffer<MouseMotionSample, 1024> _path = {};
+    };
+}
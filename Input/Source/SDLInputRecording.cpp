@@ -0,0 +1,206 @@
+#include "SDLInputRecording.h"
+#include "Tbx/Debug/Tracers.h"
+#include <bit>
+#include <cstring>
+#include <iterator>
+
+namespace Tbx::Plugins::SDLInput
+{
+    // Buffered records are written out once they pass this size, and on close.
+    static constexpr size_t FlushThreshold = 64 * 1024;
+
+    // Records are copied in and out as raw bytes, which matches the little-endian file format
+    // only on little-endian hosts.
+    static_assert(std::endian::native == std::endian::little, "Input logs are little-endian; byte-swap Append and Extract before building for this host");
+
+    template <typename T>
+    static void Append(std::vector<Uint8>& bytes, const T& value)
+    {
+        const auto* raw = reinterpret_cast<const Uint8*>(&value);
+        bytes.insert(bytes.end(), raw, raw + sizeof(T));
+    }
+
+    template <typename T>
+    static bool Extract(const std::vector<Uint8>& bytes, size_t& cursor, T& value)
+    {
+        if (bytes.size() - cursor < sizeof(T))
+        {
+            return false;
+        }
+        std::memcpy(&value, bytes.data() + cursor, sizeof(T));
+        cursor += sizeof(T);
+        return true;
+    }
+
+    bool InputRecorder::Open(const std::filesystem::path& path)
+    {
+        Close();
+        _file.open(path, std::ios::binary | std::ios::trunc);
+        if (!_file)
+        {
+            TBX_TRACE_ERROR("SD3Input: Failed to open input recording '{}'.", path.string());
+            return false;
+        }
+
+        _pending.clear();
+        Append(_pending, InputRecordingMagic);
+        Append(_pending, InputRecordingVersion);
+        return true;
+    }
+
+    void InputRecorder::Write(const InputRecord& record)
+    {
+        if (!_file.is_open())
+        {
+            return;
+        }
+
+        Append(_pending, record.Type);
+        switch (record.Type)
+        {
+            case InputRecordType::Frame:
+                break;
+            case InputRecordType::Key:
+            case InputRecordType::MouseButton:
+                Append(_pending, record.Code);
+                Append(_pending, static_cast<Uint8>(record.Down));
+                Append(_pending, record.Timestamp);
+                break;
+            case InputRecordType::MouseState:
+                Append(_pending, record.MouseButtons);
+                Append(_pending, record.MouseX);
+                Append(_pending, record.MouseY);
+                Append(_pending, record.MouseDeltaX);
+                Append(_pending, record.MouseDeltaY);
+                break;
+            case InputRecordType::GamepadButton:
+                Append(_pending, record.Slot);
+                Append(_pending, record.Code);
+                Append(_pending, static_cast<Uint8>(record.Down));
+                Append(_pending, record.Timestamp);
+                break;
+            case InputRecordType::GamepadAxis:
+                Append(_pending, record.Slot);
+                Append(_pending, record.Code);
+                Append(_pending, record.AxisValue);
+                break;
+            case InputRecordType::GamepadConnection:
+                Append(_pending, record.Slot);
+                Append(_pending, static_cast<Uint8>(record.Down));
+                break;
+        }
+
+        if (_pending.size() >= FlushThreshold)
+        {
+            Flush();
+        }
+    }
+
+    void InputRecorder::Close()
+    {
+        if (!_file.is_open())
+        {
+            return;
+        }
+
+        Flush();
+        _file.close();
+    }
+
+    bool InputRecorder::IsOpen() const
+    {
+        return _file.is_open();
+    }
+
+    void InputRecorder::Flush()
+    {
+        _file.write(reinterpret_cast<const char*>(_pending.data()), static_cast<std::streamsize>(_pending.size()));
+        _pending.clear();
+    }
+
+    bool InputReplay::Open(const std::filesystem::path& path)
+    {
+        Close();
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+        {
+            TBX_TRACE_ERROR("SD3Input: Failed to open input recording '{}'.", path.string());
+            return false;
+        }
+
+        _data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        Uint32 magic = 0;
+        Uint32 version = 0;
+        if (!Extract(_data, _cursor, magic) || !Extract(_data, _cursor, version) || magic != InputRecordingMagic || version != InputRecordingVersion)
+        {
+            TBX_TRACE_ERROR("SD3Input: '{}' is not a supported input recording.", path.string());
+            Close();
+            return false;
+        }
+
+        _open = true;
+        return true;
+    }
+
+    bool InputReplay::Next(InputRecord& record)
+    {
+        if (!_open)
+        {
+            return false;
+        }
+
+        record = {};
+        Uint8 down = 0;
+        bool complete = Extract(_data, _cursor, record.Type);
+        if (complete)
+        {
+            switch (record.Type)
+            {
+                case InputRecordType::Frame:
+                    break;
+                case InputRecordType::Key:
+                case InputRecordType::MouseButton:
+                    complete = Extract(_data, _cursor, record.Code) && Extract(_data, _cursor, down) && Extract(_data, _cursor, record.Timestamp);
+                    break;
+                case InputRecordType::MouseState:
+                    complete = Extract(_data, _cursor, record.MouseButtons) && Extract(_data, _cursor, record.MouseX) && Extract(_data, _cursor, record.MouseY)
+                        && Extract(_data, _cursor, record.MouseDeltaX) && Extract(_data, _cursor, record.MouseDeltaY);
+                    break;
+                case InputRecordType::GamepadButton:
+                    complete = Extract(_data, _cursor, record.Slot) && Extract(_data, _cursor, record.Code) && Extract(_data, _cursor, down) && Extract(_data, _cursor, record.Timestamp);
+                    break;
+                case InputRecordType::GamepadAxis:
+                    complete = Extract(_data, _cursor, record.Slot) && Extract(_data, _cursor, record.Code) && Extract(_data, _cursor, record.AxisValue);
+                    break;
+                case InputRecordType::GamepadConnection:
+                    complete = Extract(_data, _cursor, record.Slot) && Extract(_data, _cursor, down);
+                    break;
+                default:
+                    TBX_TRACE_WARNING("SD3Input: Unknown record in input recording, stopping replay.");
+                    complete = false;
+                    break;
+            }
+        }
+
+        if (!complete)
+        {
+            Close();
+            return false;
+        }
+
+        record.Down = down != 0;
+        return true;
+    }
+
+    void InputReplay::Close()
+    {
+        _data.clear();
+        _cursor = 0;
+        _open = false;
+    }
+
+    bool InputReplay::IsOpen() const
+    {
+        return _open;
+    }
+}
@@ -0,0 +1,75 @@
+#pragma once
+#include <SDL3/SDL_stdinc.h>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+namespace Tbx::Plugins::SDLInput
+{
+    // Input logs start with this header, followed by tightly packed records: a type byte
+    // and that type's fields, in little-endian byte order.
+    inline constexpr Uint32 InputRecordingMagic = 0x49584254; // "TBXI"
+    inline constexpr Uint32 InputRecordingVersion = 1;
+
+    enum class InputRecordType : Uint8
+    {
+        // Closes the records of one Update.
+        Frame,
+        Key,
+        MouseButton,
+        MouseState,
+        GamepadButton,
+        GamepadAxis,
+        GamepadConnection
+    };
+
+    // Decoded record. Only the fields used by its type are stored in the log.
+    struct InputRecord
+    {
+        InputRecordType Type = InputRecordType::Frame;
+        // Key: scancode. Mouse and gamepad buttons: SDL button. Gamepad axis: SDL axis.
+        Uint16 Code = 0;
+        Uint8 Slot = 0;
+        // Button and key direction, or whether a gamepad slot is connected.
+        bool Down = false;
+        Sint16 AxisValue = 0;
+        Uint32 MouseButtons = 0;
+        float MouseX = 0.0f;
+        float MouseY = 0.0f;
+        float MouseDeltaX = 0.0f;
+        float MouseDeltaY = 0.0f;
+        Uint64 Timestamp = 0;
+    };
+
+    // Appends records to a log file, buffering writes in memory.
+    class InputRecorder
+    {
+    public:
+        bool Open(const std::filesystem::path& path);
+        void Write(const InputRecord& record);
+        void Close();
+        bool IsOpen() const;
+
+    private:
+        void Flush();
+
+    private:
+        std::ofstream _file = {};
+        std::vector<Uint8> _pending = {};
+    };
+
+    // Reads a whole log into memory and steps through its records.
+    class InputReplay
+    {
+    public:
+        bool Open(const std::filesystem::path& path);
+        bool Next(InputRecord& record);
+        void Close();
+        bool IsOpen() const;
+
+    private:
+        std::vector<Uint8> _data = {};
+        size_t _cursor = 0;
+        bool _open = false;
+    };
+}
@@ -0,0 +1,203 @@
+#include "SDLInputSampler.h"
+#include "Tbx/Debug/Tracers.h"
+#include <SDL3/SDL_hints.h>
+#include <SDL3/SDL_joystick.h>
+#include <SDL3/SDL_timer.h>
+#include <algorithm>
+
+namespace Tbx::Plugins::SDLInput
+{
+    static thread_local bool OnSamplerThread = false;
+
+    bool SampledEventQueue::Push(const SDL_Event& event)
+    {
+        const size_t write = _write.load(std::memory_order_relaxed);
+        if (write - _read.load(std::memory_order_acquire) == Capacity)
+        {
+            _dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        _events[write & (Capacity - 1)] = event;
+        _write.store(write + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool SampledEventQueue::Pop(SDL_Event& event)
+    {
+        const size_t read = _read.load(std::memory_order_relaxed);
+        if (read == _write.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+
+        event = _events[read & (Capacity - 1)];
+        _read.store(read + 1, std::memory_order_release);
+        return true;
+    }
+
+    Uint64 SampledEventQueue::GetDropped() const
+    {
+        return _dropped.load(std::memory_order_relaxed);
+    }
+
+    InputSampler::~InputSampler()
+    {
+        Stop();
+    }
+
+    void InputSampler::Start(int rateHz)
+    {
+        Stop();
+
+        const int rate = std::clamp(rateHz, 1, 8000);
+        const Uint64 periodNs = SDL_NS_PER_SECOND / static_cast<Uint64>(rate);
+
+        // Only the sampler updates gamepads from here on, so every gamepad event comes from
+        // one thread and keeps its order through the event queue.
+        const char* autoUpdate = SDL_GetHint(SDL_HINT_AUTO_UPDATE_JOYSTICKS);
+        _hadAutoUpdate = autoUpdate != nullptr;
+        _previousAutoUpdate = _hadAutoUpdate ? autoUpdate : "";
+        SDL_SetHint(SDL_HINT_AUTO_UPDATE_JOYSTICKS, "0");
+
+        _stopping.store(false, std::memory_order_relaxed);
+        _thread = std::thread([this, periodNs]() { Run(periodNs); });
+        TBX_TRACE_INFO("SD3Input: Sampling gamepads at {} Hz.", rate);
+    }
+
+    void InputSampler::Stop()
+    {
+        if (!_thread.joinable())
+        {
+            return;
+        }
+
+        _stopping.store(true, std::memory_order_relaxed);
+        _thread.join();
+
+        if (_hadAutoUpdate)
+        {
+            SDL_SetHint(SDL_HINT_AUTO_UPDATE_JOYSTICKS, _previousAutoUpdate.c_str());
+        }
+        else
+        {
+            SDL_ResetHint(SDL_HINT_AUTO_UPDATE_JOYSTICKS);
+        }
+    }
+
+    bool InputSampler::IsRunning() const
+    {
+        return _thread.joinable();
+    }
+
+    void InputSampler::SetGamepad(int slot, SDL_Gamepad* gamepad)
+    {
+        if (slot < 0 || slot >= MaxGamepads)
+        {
+            return;
+        }
+
+        std::lock_guard lock(_padsMutex);
+        _pads[slot] = gamepad;
+    }
+
+    const InputSnapshot& InputSampler::Acquire()
+    {
+        if (_middle.load(std::memory_order_relaxed) & FreshBit)
+        {
+            _front = _middle.exchange(_front, std::memory_order_acq_rel) & IndexMask;
+        }
+        return _buffers[_front];
+    }
+
+    SampledEventQueue& InputSampler::GetEvents()
+    {
+        return _events;
+    }
+
+    bool InputSampler::IsSamplerThread()
+    {
+        return OnSamplerThread;
+    }
+
+    void InputSampler::Run(Uint64 periodNs)
+    {
+        OnSamplerThread = true;
+
+        // Pad state carries over between samples, so a skipped read republishes the last one.
+        InputSnapshot sample = {};
+        Uint64 sequence = 0;
+        Uint64 next = SDL_GetTicksNS();
+
+        while (!_stopping.load(std::memory_order_relaxed))
+        {
+            // Polls the devices. Any events this raises go through the event watch on this
+            // thread, which only queues them, so no pad lock is held here.
+            SDL_UpdateGamepads();
+            SamplePads(sample);
+            sample.Sequence = ++sequence;
+            sample.TimestampNs = SDL_GetTicksNS();
+
+            _buffers[_back] = sample;
+            _back = _middle.exchange(static_cast<Uint8>(_back | FreshBit), std::memory_order_acq_rel) & IndexMask;
+
+            // Sleep to an absolute deadline so the rate does not drift with sampling cost.
+            // When the sampler falls behind it resumes from now rather than bursting.
+            next += periodNs;
+            const Uint64 now = SDL_GetTicksNS();
+            if (next > now)
+            {
+                SDL_DelayPrecise(next - now);
+            }
+            else
+            {
+                next = now;
+            }
+        }
+    }
+
+    void InputSampler::SamplePads(InputSnapshot& sample)
+    {
+        // Holding SDL's joystick lock keeps each pad consistent across the reads. It is taken
+        // before _padsMutex, and the game thread never takes it while holding _padsMutex.
+        SDL_LockJoysticks();
+        std::unique_lock lock(_padsMutex, std::try_to_lock);
+        if (!lock.owns_lock())
+        {
+            SDL_UnlockJoysticks();
+            return;
+        }
+
+        sample.ConnectedSlots = 0;
+        for (int slot = 0; slot < MaxGamepads; ++slot)
+        {
+            SDL_Gamepad* gamepad = _pads[slot];
+            if (gamepad == nullptr)
+            {
+                sample.GamepadButtons[slot] = 0;
+                sample.GamepadAxes[slot] = {};
+                continue;
+            }
+
+            sample.ConnectedSlots |= 1u << slot;
+
+            Uint64 buttons = 0;
+            for (int b = 0; b < SDL_GAMEPAD_BUTTON_COUNT; ++b)
+            {
+                if (SDL_GetGamepadButton(gamepad, static_cast<SDL_GamepadButton>(b)))
+                {
+                    buttons |= Uint64(1) << b;
+                }
+            }
+            sample.GamepadButtons[slot] = buttons;
+
+            for (int a = 0; a < SDL_GAMEPAD_AXIS_COUNT; ++a)
+            {
+                // Convert the axis value from the range [-32768, 32767] to [-1, 1]
+                sample.GamepadAxes[slot][a] = static_cast<float>(SDL_GetGamepadAxis(gamepad, static_cast<SDL_GamepadAxis>(a))) / 32768.0f;
+            }
+        }
+        lock.unlock();
+        SDL_UnlockJoysticks();
+    }
+}
@@ -0,0 +1,111 @@
+#pragma once
+#include "SDLInputBitset.h"
+#include <SDL3/SDL_events.h>
+#include <SDL3/SDL_gamepad.h>
+#include <SDL3/SDL_stdinc.h>
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace Tbx::Plugins::SDLInput
+{
+    // Gamepad state as seen by the sampler at one instant.
+    struct InputSnapshot
+    {
+        // Increments with every sample; equal sequences mean nothing new was published.
+        Uint64 Sequence = 0;
+        Uint64 TimestampNs = 0;
+        // Bit per slot, set while a gamepad is open in it.
+        Uint32 ConnectedSlots = 0;
+        // Bit per SDL_GamepadButton, per slot.
+        std::array<Uint64, MaxGamepads> GamepadButtons = {};
+        std::array<std::array<float, SDL_GAMEPAD_AXIS_COUNT>, MaxGamepads> GamepadAxes = {};
+    };
+    static_assert(MaxGamepads <= 32, "ConnectedSlots holds one bit per gamepad slot");
+
+    // Single-producer, single-consumer queue of SDL events. The sampler thread pushes the
+    // gamepad events its device updates generate, and the game thread drains them in Update.
+    class SampledEventQueue
+    {
+    public:
+        static constexpr size_t Capacity = 2048;
+
+        // Producer only. Returns false, and counts a drop, when the game thread has fallen a
+        // whole queue behind.
+        bool Push(const SDL_Event& event);
+        // Consumer only.
+        bool Pop(SDL_Event& event);
+        Uint64 GetDropped() const;
+
+    private:
+        static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+        std::array<SDL_Event, Capacity> _events = {};
+        // Kept on separate cache lines so the producer and consumer do not contend.
+        alignas(64) std::atomic<size_t> _write = 0;
+        alignas(64) std::atomic<size_t> _read = 0;
+        std::atomic<Uint64> _dropped = 0;
+    };
+
+    // Samples gamepads on a dedicated thread at a fixed rate and publishes each sample through
+    // a lock-free triple buffer. A single reader always gets the freshest complete snapshot
+    // without waiting on the sampler, and the sampler never waits on the reader.
+    //
+    // While running, the sampler is the only thread that updates gamepads: SDL's automatic
+    // joystick update in the game thread's event pump is switched off. The gamepad events
+    // those updates generate reach the event watch on the sampler thread and must be handed
+    // to the game thread through Events rather than applied there.
+    class InputSampler
+    {
+    public:
+        InputSampler() = default;
+        ~InputSampler();
+
+        InputSampler(const InputSampler&) = delete;
+        InputSampler& operator=(const InputSampler&) = delete;
+
+        void Start(int rateHz);
+        void Stop();
+        bool IsRunning() const;
+
+        // Mirrors the plugin's gamepad slots. Must be called with nullptr before a handle is
+        // closed; blocks for at most one sample while the sampler is reading pads.
+        void SetGamepad(int slot, SDL_Gamepad* gamepad);
+
+        // Returns the latest published snapshot. Only one thread may read.
+        const InputSnapshot& Acquire();
+
+        // Events raised by the sampler's device updates, waiting for the game thread.
+        SampledEventQueue& GetEvents();
+        // True when called from the sampler thread.
+        static bool IsSamplerThread();
+
+    private:
+        void Run(Uint64 periodNs);
+        void SamplePads(InputSnapshot& sample);
+
+    private:
+        // The low bits hold a buffer index; FreshBit marks a snapshot the reader has not seen.
+        static constexpr Uint8 IndexMask = 0x3;
+        static constexpr Uint8 FreshBit = 0x4;
+
+        std::array<InputSnapshot, 3> _buffers = {};
+        std::atomic<Uint8> _middle = 1;
+        Uint8 _front = 0;
+        Uint8 _back = 2;
+
+        std::thread _thread = {};
+        std::atomic<bool> _stopping = false;
+        SampledEventQueue _events = {};
+        // The auto-update hint as it was before Start, restored by Stop.
+        std::string _previousAutoUpdate = {};
+        bool _hadAutoUpdate = false;
+
+        // Guards hotplug changes. The sampler only ever try-locks it and keeps the previous
+        // pad state for that sample when the game thread holds it.
+        std::mutex _padsMutex = {};
+        std::array<SDL_Gamepad*, MaxGamepads> _pads = {};
+    };
+}
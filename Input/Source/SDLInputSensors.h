@@ -0,0 +1,54 @@
+#pragma once
+#include "SDLInputEventBuffer.h"
+#include <SDL3/SDL_stdinc.h>
+
+namespace Tbx::Plugins::SDLInput
+{
+    // A gyroscope or accelerometer reading in SDL's units: radians per second for the gyro,
+    // meters per second squared for the accelerometer.
+    struct MotionSample
+    {
+        // Sensor timestamp in nanoseconds, or the event time when the device reports none.
+        Uint64 Timestamp = 0;
+        float X = 0.0f;
+        float Y = 0.0f;
+        float Z = 0.0f;
+    };
+
+    struct TouchSample
+    {
+        Uint64 Timestamp = 0;
+        Uint8 Touchpad = 0;
+        Uint8 Finger = 0;
+        // False for the sample that lifts the finger.
+        bool Down = false;
+        // Normalized to [0, 1], origin at the top left.
+        float X = 0.0f;
+        float Y = 0.0f;
+        float Pressure = 0.0f;
+    };
+
+    // Every sensor sample a gamepad delivered, kept per frame. Under steady 1 kHz input each
+    // motion ring has room for 128 samples a frame, so nothing is lost at frame rates down to
+    // about 8 Hz.
+    struct GamepadSensorStreams
+    {
+        FrameRingBuffer<MotionSample, 256> Gyro = {};
+        FrameRingBuffer<MotionSample, 256> Accel = {};
+        FrameRingBuffer<TouchSample, 128> Touch = {};
+
+        void EndFrame()
+        {
+            Gyro.EndFrame();
+            Accel.EndFrame();
+            Touch.EndFrame();
+        }
+
+        void Clear()
+        {
+            Gyro.Clear();
+            Accel.Clear();
+            Touch.Clear();
+        }
+    };
+}
@@ -1,161 +1,391 @@
 #pragma once
 #include <Tbx/Input/InputCodes.h>
 #include <SDL3/SDL.h>
+#include <array>
+#include <cstddef>
+#include <cstdint>
 
+// TBX <-> SDL input code conversion. Each direction is a dense table generated at compile
+// time from a single mapping list, so a conversion is one bounds check and one load.
 namespace Tbx::Plugins::SDLInput
 {
-    // Convert TBX key to SDL_Scancode
-    inline SDL_Scancode ConvertKey(int tbxKey)
+    template <typename TSdlCode>
+    struct CodeMapping
+    {
+        int Tbx = 0;
+        TSdlCode Sdl = {};
+    };
+
+    namespace Detail
     {
-        switch (tbxKey)
+        template <typename TSdlCode, size_t Count>
+        constexpr size_t GetTbxTableSize(const std::array<CodeMapping<TSdlCode>, Count>& mappings)
+        {
+            int highest = 0;
+            for (const auto& mapping : mappings)
+            {
+                highest = mapping.Tbx > highest ? mapping.Tbx : highest;
+            }
+            return static_cast<size_t>(highest) + 1;
+        }
+
+        template <size_t Size, typename TSdlCode, size_t Count>
+        constexpr std::array<TSdlCode, Size> BuildTbxToSdl(const std::array<CodeMapping<TSdlCode>, Count>& mappings, TSdlCode unmapped)
+        {
+            std::array<TSdlCode, Size> table = {};
+            table.fill(unmapped);
+            for (const auto& mapping : mappings)
+            {
+                table[static_cast<size_t>(mapping.Tbx)] = mapping.Sdl;
+            }
+            return table;
+        }
+
+        template <size_t Size, typename TSdlCode, size_t Count>
+        constexpr std::array<int, Size> BuildSdlToTbx(const std::array<CodeMapping<TSdlCode>, Count>& mappings)
+        {
+            std::array<int, Size> table = {};
+            table.fill(-1);
+            for (const auto& mapping : mappings)
+            {
+                table[static_cast<size_t>(mapping.Sdl)] = mapping.Tbx;
+            }
+            return table;
+        }
+
+        // Every entry maps a valid code on both sides and no code appears twice, so the two
+        // tables are exact inverses.
+        template <typename TSdlCode, size_t Count>
+        constexpr bool IsOneToOne(const std::array<CodeMapping<TSdlCode>, Count>& mappings, TSdlCode unmapped, size_t sdlCount)
+        {
+            for (size_t i = 0; i < Count; ++i)
+            {
+                const auto sdl = static_cast<long long>(mappings[i].Sdl);
+                if (mappings[i].Tbx < 0 || mappings[i].Sdl == unmapped || sdl < 0 || sdl >= static_cast<long long>(sdlCount))
+                {
+                    return false;
+                }
+                for (size_t j = i + 1; j < Count; ++j)
+                {
+                    if (mappings[i].Tbx == mappings[j].Tbx || mappings[i].Sdl == mappings[j].Sdl)
+                    {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+        // The TBX codes form a contiguous range, so none between the first and last is missing.
+        template <typename TSdlCode, size_t Count>
+        constexpr bool CoversTbxRange(const std::array<CodeMapping<TSdlCode>, Count>& mappings, int first, int last)
         {
-            case TBX_KEY_SPACE:          return SDL_SCANCODE_SPACE;
-            case TBX_KEY_APOSTROPHE:     return SDL_SCANCODE_APOSTROPHE;
-            case TBX_KEY_COMMA:          return SDL_SCANCODE_COMMA;
-            case TBX_KEY_MINUS:          return SDL_SCANCODE_MINUS;
-            case TBX_KEY_PERIOD:         return SDL_SCANCODE_PERIOD;
-            case TBX_KEY_SLASH:          return SDL_SCANCODE_SLASH;
-            case TBX_KEY_0:              return SDL_SCANCODE_0;
-            case TBX_KEY_1:              return SDL_SCANCODE_1;
-            case TBX_KEY_2:              return SDL_SCANCODE_2;
-            case TBX_KEY_3:              return SDL_SCANCODE_3;
-            case TBX_KEY_4:              return SDL_SCANCODE_4;
-            case TBX_KEY_5:              return SDL_SCANCODE_5;
-            case TBX_KEY_6:              return SDL_SCANCODE_6;
-            case TBX_KEY_7:              return SDL_SCANCODE_7;
-            case TBX_KEY_8:              return SDL_SCANCODE_8;
-            case TBX_KEY_9:              return SDL_SCANCODE_9;
-            case TBX_KEY_A:              return SDL_SCANCODE_A;
-            case TBX_KEY_B:              return SDL_SCANCODE_B;
-            case TBX_KEY_C:              return SDL_SCANCODE_C;
-            case TBX_KEY_D:              return SDL_SCANCODE_D;
-            case TBX_KEY_E:              return SDL_SCANCODE_E;
-            case TBX_KEY_F:              return SDL_SCANCODE_F;
-            case TBX_KEY_G:              return SDL_SCANCODE_G;
-            case TBX_KEY_H:              return SDL_SCANCODE_H;
-            case TBX_KEY_I:              return SDL_SCANCODE_I;
-            case TBX_KEY_J:              return SDL_SCANCODE_J;
-            case TBX_KEY_K:              return SDL_SCANCODE_K;
-            case TBX_KEY_L:              return SDL_SCANCODE_L;
-            case TBX_KEY_M:              return SDL_SCANCODE_M;
-            case TBX_KEY_N:              return SDL_SCANCODE_N;
-            case TBX_KEY_O:              return SDL_SCANCODE_O;
-            case TBX_KEY_P:              return SDL_SCANCODE_P;
-            case TBX_KEY_Q:              return SDL_SCANCODE_Q;
-            case TBX_KEY_R:              return SDL_SCANCODE_R;
-            case TBX_KEY_S:              return SDL_SCANCODE_S;
-            case TBX_KEY_T:              return SDL_SCANCODE_T;
-            case TBX_KEY_U:              return SDL_SCANCODE_U;
-            case TBX_KEY_V:              return SDL_SCANCODE_V;
-            case TBX_KEY_W:              return SDL_SCANCODE_W;
-            case TBX_KEY_X:              return SDL_SCANCODE_X;
-            case TBX_KEY_Y:              return SDL_SCANCODE_Y;
-            case TBX_KEY_Z:              return SDL_SCANCODE_Z;
-            case TBX_KEY_ESCAPE:         return SDL_SCANCODE_ESCAPE;
-            case TBX_KEY_ENTER:          return SDL_SCANCODE_RETURN;
-            case TBX_KEY_TAB:            return SDL_SCANCODE_TAB;
-            case TBX_KEY_BACKSPACE:      return SDL_SCANCODE_BACKSPACE;
-            case TBX_KEY_INSERT:         return SDL_SCANCODE_INSERT;
-            case TBX_KEY_DELETE:         return SDL_SCANCODE_DELETE;
-            case TBX_KEY_RIGHT:          return SDL_SCANCODE_RIGHT;
-            case TBX_KEY_LEFT:           return SDL_SCANCODE_LEFT;
-            case TBX_KEY_DOWN:           return SDL_SCANCODE_DOWN;
-            case TBX_KEY_UP:             return SDL_SCANCODE_UP;
-            case TBX_KEY_PAGE_UP:        return SDL_SCANCODE_PAGEUP;
-            case TBX_KEY_PAGE_DOWN:      return SDL_SCANCODE_PAGEDOWN;
-            case TBX_KEY_HOME:           return SDL_SCANCODE_HOME;
-            case TBX_KEY_END:            return SDL_SCANCODE_END;
-            case TBX_KEY_CAPS_LOCK:      return SDL_SCANCODE_CAPSLOCK;
-            case TBX_KEY_SCROLL_LOCK:    return SDL_SCANCODE_SCROLLLOCK;
-            case TBX_KEY_NUM_LOCK:       return SDL_SCANCODE_NUMLOCKCLEAR;
-            case TBX_KEY_PRINT_SCREEN:   return SDL_SCANCODE_PRINTSCREEN;
-            case TBX_KEY_PAUSE:          return SDL_SCANCODE_PAUSE;
-            case TBX_KEY_F1:             return SDL_SCANCODE_F1;
-            case TBX_KEY_F2:             return SDL_SCANCODE_F2;
-            case TBX_KEY_F3:             return SDL_SCANCODE_F3;
-            case TBX_KEY_F4:             return SDL_SCANCODE_F4;
-            case TBX_KEY_F5:             return SDL_SCANCODE_F5;
-            case TBX_KEY_F6:             return SDL_SCANCODE_F6;
-            case TBX_KEY_F7:             return SDL_SCANCODE_F7;
-            case TBX_KEY_F8:             return SDL_SCANCODE_F8;
-            case TBX_KEY_F9:             return SDL_SCANCODE_F9;
-            case TBX_KEY_F10:            return SDL_SCANCODE_F10;
-            case TBX_KEY_F11:            return SDL_SCANCODE_F11;
-            case TBX_KEY_F12:            return SDL_SCANCODE_F12;
-            case TBX_KEY_KP_0:           return SDL_SCANCODE_KP_0;
-            case TBX_KEY_KP_1:           return SDL_SCANCODE_KP_1;
-            case TBX_KEY_KP_2:           return SDL_SCANCODE_KP_2;
-            case TBX_KEY_KP_3:           return SDL_SCANCODE_KP_3;
-            case TBX_KEY_KP_4:           return SDL_SCANCODE_KP_4;
-            case TBX_KEY_KP_5:           return SDL_SCANCODE_KP_5;
-            case TBX_KEY_KP_6:           return SDL_SCANCODE_KP_6;
-            case TBX_KEY_KP_7:           return SDL_SCANCODE_KP_7;
-            case TBX_KEY_KP_8:           return SDL_SCANCODE_KP_8;
-            case TBX_KEY_KP_9:           return SDL_SCANCODE_KP_9;
-            case TBX_KEY_LEFT_SHIFT:     return SDL_SCANCODE_LSHIFT;
-            case TBX_KEY_LEFT_CONTROL:   return SDL_SCANCODE_LCTRL;
-            case TBX_KEY_LEFT_ALT:       return SDL_SCANCODE_LALT;
-            case TBX_KEY_LEFT_SUPER:     return SDL_SCANCODE_LGUI;
-            case TBX_KEY_RIGHT_SHIFT:    return SDL_SCANCODE_RSHIFT;
-            case TBX_KEY_RIGHT_CONTROL:  return SDL_SCANCODE_RCTRL;
-            case TBX_KEY_RIGHT_ALT:      return SDL_SCANCODE_RALT;
-            case TBX_KEY_RIGHT_SUPER:    return SDL_SCANCODE_RGUI;
-            case TBX_KEY_MENU:           return SDL_SCANCODE_MENU;
-            default:                     return SDL_SCANCODE_UNKNOWN;
+            if (static_cast<size_t>(last - first + 1) != Count)
+            {
+                return false;
+            }
+            for (const auto& mapping : mappings)
+            {
+                if (mapping.Tbx < first || mapping.Tbx > last)
+                {
+                    return false;
+                }
+            }
+            return true;
         }
+
+        // Every listed TBX code is mapped unless it is listed as unmapped, and no mapping uses
+        // a code missing from the list.
+        template <typename TSdlCode, size_t Count, size_t CodeCount, size_t UnmappedCount>
+        constexpr bool CoversTbxCodes(const std::array<CodeMapping<TSdlCode>, Count>& mappings, const std::array<int, CodeCount>& codes, const std::array<int, UnmappedCount>& unmapped)
+        {
+            for (const int code : codes)
+            {
+                bool mapped = false;
+                for (const auto& mapping : mappings)
+                {
+                    mapped = mapped || mapping.Tbx == code;
+                }
+                bool excluded = false;
+                for (const int skipped : unmapped)
+                {
+                    excluded = excluded || skipped == code;
+                }
+                if (mapped == excluded)
+                {
+                    return false;
+                }
+            }
+            for (const auto& mapping : mappings)
+            {
+                bool listed = false;
+                for (const int code : codes)
+                {
+                    listed = listed || mapping.Tbx == code;
+                }
+                if (!listed)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        template <typename TValue, size_t Size>
+        constexpr TValue Lookup(const std::array<TValue, Size>& table, long long index, TValue fallback)
+        {
+            return static_cast<unsigned long long>(index) < Size ? table[static_cast<size_t>(index)] : fallback;
+        }
+    }
+
+    inline constexpr std::array KeyMappings = std::to_array<CodeMapping<SDL_Scancode>>({
+        { TBX_KEY_SPACE,         SDL_SCANCODE_SPACE },
+        { TBX_KEY_APOSTROPHE,    SDL_SCANCODE_APOSTROPHE },
+        { TBX_KEY_COMMA,         SDL_SCANCODE_COMMA },
+        { TBX_KEY_MINUS,         SDL_SCANCODE_MINUS },
+        { TBX_KEY_PERIOD,        SDL_SCANCODE_PERIOD },
+        { TBX_KEY_SLASH,         SDL_SCANCODE_SLASH },
+        { TBX_KEY_0,             SDL_SCANCODE_0 },
+        { TBX_KEY_1,             SDL_SCANCODE_1 },
+        { TBX_KEY_2,             SDL_SCANCODE_2 },
+        { TBX_KEY_3,             SDL_SCANCODE_3 },
+        { TBX_KEY_4,             SDL_SCANCODE_4 },
+        { TBX_KEY_5,             SDL_SCANCODE_5 },
+        { TBX_KEY_6,             SDL_SCANCODE_6 },
+        { TBX_KEY_7,             SDL_SCANCODE_7 },
+        { TBX_KEY_8,             SDL_SCANCODE_8 },
+        { TBX_KEY_9,             SDL_SCANCODE_9 },
+        { TBX_KEY_SEMICOLON,     SDL_SCANCODE_SEMICOLON },
+        { TBX_KEY_EQUAL,         SDL_SCANCODE_EQUALS },
+        { TBX_KEY_A,             SDL_SCANCODE_A },
+        { TBX_KEY_B,             SDL_SCANCODE_B },
+        { TBX_KEY_C,             SDL_SCANCODE_C },
+        { TBX_KEY_D,             SDL_SCANCODE_D },
+        { TBX_KEY_E,             SDL_SCANCODE_E },
+        { TBX_KEY_F,             SDL_SCANCODE_F },
+        { TBX_KEY_G,             SDL_SCANCODE_G },
+        { TBX_KEY_H,             SDL_SCANCODE_H },
+        { TBX_KEY_I,             SDL_SCANCODE_I },
+        { TBX_KEY_J,             SDL_SCANCODE_J },
+        { TBX_KEY_K,             SDL_SCANCODE_K },
+        { TBX_KEY_L,             SDL_SCANCODE_L },
+        { TBX_KEY_M,             SDL_SCANCODE_M },
+        { TBX_KEY_N,             SDL_SCANCODE_N },
+        { TBX_KEY_O,             SDL_SCANCODE_O },
+        { TBX_KEY_P,             SDL_SCANCODE_P },
+        { TBX_KEY_Q,             SDL_SCANCODE_Q },
+        { TBX_KEY_R,             SDL_SCANCODE_R },
+        { TBX_KEY_S,             SDL_SCANCODE_S },
+        { TBX_KEY_T,             SDL_SCANCODE_T },
+        { TBX_KEY_U,             SDL_SCANCODE_U },
+        { TBX_KEY_V,             SDL_SCANCODE_V },
+        { TBX_KEY_W,             SDL_SCANCODE_W },
+        { TBX_KEY_X,             SDL_SCANCODE_X },
+        { TBX_KEY_Y,             SDL_SCANCODE_Y },
+        { TBX_KEY_Z,             SDL_SCANCODE_Z },
+        { TBX_KEY_LEFT_BRACKET,  SDL_SCANCODE_LEFTBRACKET },
+        { TBX_KEY_BACKSLASH,     SDL_SCANCODE_BACKSLASH },
+        { TBX_KEY_RIGHT_BRACKET, SDL_SCANCODE_RIGHTBRACKET },
+        { TBX_KEY_GRAVE_ACCENT,  SDL_SCANCODE_GRAVE },
+        { TBX_KEY_ESCAPE,        SDL_SCANCODE_ESCAPE },
+        { TBX_KEY_ENTER,         SDL_SCANCODE_RETURN },
+        { TBX_KEY_TAB,           SDL_SCANCODE_TAB },
+        { TBX_KEY_BACKSPACE,     SDL_SCANCODE_BACKSPACE },
+        { TBX_KEY_INSERT,        SDL_SCANCODE_INSERT },
+        { TBX_KEY_DELETE,        SDL_SCANCODE_DELETE },
+        { TBX_KEY_RIGHT,         SDL_SCANCODE_RIGHT },
+        { TBX_KEY_LEFT,          SDL_SCANCODE_LEFT },
+        { TBX_KEY_DOWN,          SDL_SCANCODE_DOWN },
+        { TBX_KEY_UP,            SDL_SCANCODE_UP },
+        { TBX_KEY_PAGE_UP,       SDL_SCANCODE_PAGEUP },
+        { TBX_KEY_PAGE_DOWN,     SDL_SCANCODE_PAGEDOWN },
+        { TBX_KEY_HOME,          SDL_SCANCODE_HOME },
+        { TBX_KEY_END,           SDL_SCANCODE_END },
+        { TBX_KEY_CAPS_LOCK,     SDL_SCANCODE_CAPSLOCK },
+        { TBX_KEY_SCROLL_LOCK,   SDL_SCANCODE_SCROLLLOCK },
+        { TBX_KEY_NUM_LOCK,      SDL_SCANCODE_NUMLOCKCLEAR },
+        { TBX_KEY_PRINT_SCREEN,  SDL_SCANCODE_PRINTSCREEN },
+        { TBX_KEY_PAUSE,         SDL_SCANCODE_PAUSE },
+        { TBX_KEY_F1,            SDL_SCANCODE_F1 },
+        { TBX_KEY_F2,            SDL_SCANCODE_F2 },
+        { TBX_KEY_F3,            SDL_SCANCODE_F3 },
+        { TBX_KEY_F4,            SDL_SCANCODE_F4 },
+        { TBX_KEY_F5,            SDL_SCANCODE_F5 },
+        { TBX_KEY_F6,            SDL_SCANCODE_F6 },
+        { TBX_KEY_F7,            SDL_SCANCODE_F7 },
+        { TBX_KEY_F8,            SDL_SCANCODE_F8 },
+        { TBX_KEY_F9,            SDL_SCANCODE_F9 },
+        { TBX_KEY_F10,           SDL_SCANCODE_F10 },
+        { TBX_KEY_F11,           SDL_SCANCODE_F11 },
+        { TBX_KEY_F12,           SDL_SCANCODE_F12 },
+        { TBX_KEY_F13,        SDL_SCANCODE_F13 },
+        { TBX_KEY_F14,        SDL_SCANCODE_F14 },
+        { TBX_KEY_F15,        SDL_SCANCODE_F15 },
+        { TBX_KEY_F16,        SDL_SCANCODE_F16 },
+        { TBX_KEY_F17,        SDL_SCANCODE_F17 },
+        { TBX_KEY_F18,        SDL_SCANCODE_F18 },
+        { TBX_KEY_F19,        SDL_SCANCODE_F19 },
+        { TBX_KEY_F20,        SDL_SCANCODE_F20 },
+        { TBX_KEY_F21,        SDL_SCANCODE_F21 },
+        { TBX_KEY_F22,        SDL_SCANCODE_F22 },
+        { TBX_KEY_F23,        SDL_SCANCODE_F23 },
+        { TBX_KEY_F24,        SDL_SCANCODE_F24 },
+        { TBX_KEY_KP_0,          SDL_SCANCODE_KP_0 },
+        { TBX_KEY_KP_1,          SDL_SCANCODE_KP_1 },
+        { TBX_KEY_KP_2,          SDL_SCANCODE_KP_2 },
+        { TBX_KEY_KP_3,          SDL_SCANCODE_KP_3 },
+        { TBX_KEY_KP_4,          SDL_SCANCODE_KP_4 },
+        { TBX_KEY_KP_5,          SDL_SCANCODE_KP_5 },
+        { TBX_KEY_KP_6,          SDL_SCANCODE_KP_6 },
+        { TBX_KEY_KP_7,          SDL_SCANCODE_KP_7 },
+        { TBX_KEY_KP_8,          SDL_SCANCODE_KP_8 },
+        { TBX_KEY_KP_9,          SDL_SCANCODE_KP_9 },
+        { TBX_KEY_KP_DECIMAL,    SDL_SCANCODE_KP_PERIOD },
+        { TBX_KEY_KP_DIVIDE,     SDL_SCANCODE_KP_DIVIDE },
+        { TBX_KEY_KP_MULTIPLY,   SDL_SCANCODE_KP_MULTIPLY },
+        { TBX_KEY_KP_SUBTRACT,   SDL_SCANCODE_KP_MINUS },
+        { TBX_KEY_KP_ADD,        SDL_SCANCODE_KP_PLUS },
+        { TBX_KEY_KP_ENTER,      SDL_SCANCODE_KP_ENTER },
+        { TBX_KEY_KP_EQUAL,      SDL_SCANCODE_KP_EQUALS },
+        { TBX_KEY_LEFT_SHIFT,    SDL_SCANCODE_LSHIFT },
+        { TBX_KEY_LEFT_CONTROL,  SDL_SCANCODE_LCTRL },
+        { TBX_KEY_LEFT_ALT,      SDL_SCANCODE_LALT },
+        { TBX_KEY_LEFT_SUPER,    SDL_SCANCODE_LGUI },
+        { TBX_KEY_RIGHT_SHIFT,   SDL_SCANCODE_RSHIFT },
+        { TBX_KEY_RIGHT_CONTROL, SDL_SCANCODE_RCTRL },
+        { TBX_KEY_RIGHT_ALT,     SDL_SCANCODE_RALT },
+        { TBX_KEY_RIGHT_SUPER,   SDL_SCANCODE_RGUI },
+        { TBX_KEY_MENU,          SDL_SCANCODE_MENU },
+    });
+
+    inline constexpr std::array MouseButtonMappings = std::to_array<CodeMapping<uint8_t>>({
+        { TBX_MOUSE_BUTTON_LEFT,   SDL_BUTTON_LEFT },
+        { TBX_MOUSE_BUTTON_RIGHT,  SDL_BUTTON_RIGHT },
+        { TBX_MOUSE_BUTTON_MIDDLE, SDL_BUTTON_MIDDLE },
+        { TBX_MOUSE_BUTTON_4,      SDL_BUTTON_X1 },
+        { TBX_MOUSE_BUTTON_5,      SDL_BUTTON_X2 },
+    });
+
+    inline constexpr std::array GamepadButtonMappings = std::to_array<CodeMapping<SDL_GamepadButton>>({
+        { TBX_GAMEPAD_BUTTON_SOUTH,        SDL_GAMEPAD_BUTTON_SOUTH },
+        { TBX_GAMEPAD_BUTTON_EAST,         SDL_GAMEPAD_BUTTON_EAST },
+        { TBX_GAMEPAD_BUTTON_WEST,         SDL_GAMEPAD_BUTTON_WEST },
+        { TBX_GAMEPAD_BUTTON_NORTH,        SDL_GAMEPAD_BUTTON_NORTH },
+        { TBX_GAMEPAD_BUTTON_LEFT_BUMPER,  SDL_GAMEPAD_BUTTON_LEFT_SHOULDER },
+        { TBX_GAMEPAD_BUTTON_RIGHT_BUMPER, SDL_GAMEPAD_BUTTON_RIGHT_SHOULDER },
+        { TBX_GAMEPAD_BUTTON_BACK,         SDL_GAMEPAD_BUTTON_BACK },
+        { TBX_GAMEPAD_BUTTON_START,        SDL_GAMEPAD_BUTTON_START },
+        { TBX_GAMEPAD_BUTTON_GUIDE,        SDL_GAMEPAD_BUTTON_GUIDE },
+        { TBX_GAMEPAD_BUTTON_LEFT_THUMB,   SDL_GAMEPAD_BUTTON_LEFT_STICK },
+        { TBX_GAMEPAD_BUTTON_RIGHT_THUMB,  SDL_GAMEPAD_BUTTON_RIGHT_STICK },
+        { TBX_GAMEPAD_BUTTON_DPAD_UP,      SDL_GAMEPAD_BUTTON_DPAD_UP },
+        { TBX_GAMEPAD_BUTTON_DPAD_RIGHT,   SDL_GAMEPAD_BUTTON_DPAD_RIGHT },
+        { TBX_GAMEPAD_BUTTON_DPAD_DOWN,    SDL_GAMEPAD_BUTTON_DPAD_DOWN },
+        { TBX_GAMEPAD_BUTTON_DPAD_LEFT,    SDL_GAMEPAD_BUTTON_DPAD_LEFT },
+    });
+
+    inline constexpr std::array GamepadAxisMappings = std::to_array<CodeMapping<SDL_GamepadAxis>>({
+        { TBX_GAMEPAD_AXIS_LEFT_X,        SDL_GAMEPAD_AXIS_LEFTX },
+        { TBX_GAMEPAD_AXIS_LEFT_Y,        SDL_GAMEPAD_AXIS_LEFTY },
+        { TBX_GAMEPAD_AXIS_RIGHT_X,       SDL_GAMEPAD_AXIS_RIGHTX },
+        { TBX_GAMEPAD_AXIS_RIGHT_Y,       SDL_GAMEPAD_AXIS_RIGHTY },
+        { TBX_GAMEPAD_AXIS_LEFT_TRIGGER,  SDL_GAMEPAD_AXIS_LEFT_TRIGGER },
+        { TBX_GAMEPAD_AXIS_RIGHT_TRIGGER, SDL_GAMEPAD_AXIS_RIGHT_TRIGGER },
+    });
+
+    // Every key code TBX defines, to check the key mappings against.
+    inline constexpr std::array AllTbxKeys = std::to_array<int>({
+        TBX_KEY_SPACE, TBX_KEY_APOSTROPHE, TBX_KEY_COMMA, TBX_KEY_MINUS, TBX_KEY_PERIOD,
+        TBX_KEY_SLASH, TBX_KEY_0, TBX_KEY_1, TBX_KEY_2, TBX_KEY_3, TBX_KEY_4, TBX_KEY_5, TBX_KEY_6,
+        TBX_KEY_7, TBX_KEY_8, TBX_KEY_9, TBX_KEY_SEMICOLON, TBX_KEY_EQUAL, TBX_KEY_A, TBX_KEY_B,
+        TBX_KEY_C, TBX_KEY_D, TBX_KEY_E, TBX_KEY_F, TBX_KEY_G, TBX_KEY_H, TBX_KEY_I, TBX_KEY_J,
+        TBX_KEY_K, TBX_KEY_L, TBX_KEY_M, TBX_KEY_N, TBX_KEY_O, TBX_KEY_P, TBX_KEY_Q, TBX_KEY_R,
+        TBX_KEY_S, TBX_KEY_T, TBX_KEY_U, TBX_KEY_V, TBX_KEY_W, TBX_KEY_X, TBX_KEY_Y, TBX_KEY_Z,
+        TBX_KEY_LEFT_BRACKET, TBX_KEY_BACKSLASH, TBX_KEY_RIGHT_BRACKET, TBX_KEY_GRAVE_ACCENT,
+        TBX_KEY_ESCAPE, TBX_KEY_ENTER, TBX_KEY_TAB, TBX_KEY_BACKSPACE, TBX_KEY_INSERT,
+        TBX_KEY_DELETE, TBX_KEY_RIGHT, TBX_KEY_LEFT, TBX_KEY_DOWN, TBX_KEY_UP, TBX_KEY_PAGE_UP,
+        TBX_KEY_PAGE_DOWN, TBX_KEY_HOME, TBX_KEY_END, TBX_KEY_CAPS_LOCK, TBX_KEY_SCROLL_LOCK,
+        TBX_KEY_NUM_LOCK, TBX_KEY_PRINT_SCREEN, TBX_KEY_PAUSE, TBX_KEY_F1, TBX_KEY_F2, TBX_KEY_F3,
+        TBX_KEY_F4, TBX_KEY_F5, TBX_KEY_F6, TBX_KEY_F7, TBX_KEY_F8, TBX_KEY_F9, TBX_KEY_F10,
+        TBX_KEY_F11, TBX_KEY_F12, TBX_KEY_F13, TBX_KEY_F14, TBX_KEY_F15, TBX_KEY_F16, TBX_KEY_F17,
+        TBX_KEY_F18, TBX_KEY_F19, TBX_KEY_F20, TBX_KEY_F21, TBX_KEY_F22, TBX_KEY_F23, TBX_KEY_F24,
+        TBX_KEY_F25, TBX_KEY_KP_0, TBX_KEY_KP_1, TBX_KEY_KP_2, TBX_KEY_KP_3, TBX_KEY_KP_4,
+        TBX_KEY_KP_5, TBX_KEY_KP_6, TBX_KEY_KP_7, TBX_KEY_KP_8, TBX_KEY_KP_9, TBX_KEY_KP_DECIMAL,
+        TBX_KEY_KP_DIVIDE, TBX_KEY_KP_MULTIPLY, TBX_KEY_KP_SUBTRACT, TBX_KEY_KP_ADD,
+        TBX_KEY_KP_ENTER, TBX_KEY_KP_EQUAL, TBX_KEY_LEFT_SHIFT, TBX_KEY_LEFT_CONTROL,
+        TBX_KEY_LEFT_ALT, TBX_KEY_LEFT_SUPER, TBX_KEY_RIGHT_SHIFT, TBX_KEY_RIGHT_CONTROL,
+        TBX_KEY_RIGHT_ALT, TBX_KEY_RIGHT_SUPER, TBX_KEY_MENU,
+    });
+    // SDL has no scancode for these.
+    inline constexpr std::array UnmappedTbxKeys = std::to_array<int>({ TBX_KEY_F25 });
+
+    inline constexpr size_t SdlMouseButtonCount = SDL_BUTTON_X2 + 1;
+
+    static_assert(Detail::IsOneToOne(KeyMappings, SDL_SCANCODE_UNKNOWN, SDL_SCANCODE_COUNT), "Key mappings must be one-to-one.");
+    static_assert(Detail::IsOneToOne(MouseButtonMappings, uint8_t{ 0 }, SdlMouseButtonCount), "Mouse button mappings must be one-to-one.");
+    static_assert(Detail::IsOneToOne(GamepadButtonMappings, SDL_GAMEPAD_BUTTON_INVALID, SDL_GAMEPAD_BUTTON_COUNT), "Gamepad button mappings must be one-to-one.");
+    static_assert(Detail::IsOneToOne(GamepadAxisMappings, SDL_GAMEPAD_AXIS_INVALID, SDL_GAMEPAD_AXIS_COUNT), "Gamepad axis mappings must be one-to-one.");
+    static_assert(Detail::CoversTbxCodes(KeyMappings, AllTbxKeys, UnmappedTbxKeys), "Every TBX key must be mapped or listed as unmapped.");
+    static_assert(Detail::CoversTbxRange(MouseButtonMappings, TBX_MOUSE_BUTTON_1, TBX_MOUSE_BUTTON_5), "Every TBX mouse button must be mapped.");
+    static_assert(Detail::CoversTbxRange(GamepadButtonMappings, TBX_GAMEPAD_BUTTON_SOUTH, TBX_GAMEPAD_BUTTON_DPAD_LEFT), "Every TBX gamepad button must be mapped.");
+    static_assert(Detail::CoversTbxRange(GamepadAxisMappings, TBX_GAMEPAD_AXIS_LEFT_X, TBX_GAMEPAD_AXIS_RIGHT_TRIGGER), "Every TBX gamepad axis must be mapped.");
+
+    inline constexpr auto TbxToSdlKeys = Detail::BuildTbxToSdl<Detail::GetTbxTableSize(KeyMappings)>(KeyMappings, SDL_SCANCODE_UNKNOWN);
+    inline constexpr auto SdlToTbxKeys = Detail::BuildSdlToTbx<SDL_SCANCODE_COUNT>(KeyMappings);
+    inline constexpr auto TbxToSdlMouseButtons = Detail::BuildTbxToSdl<Detail::GetTbxTableSize(MouseButtonMappings)>(MouseButtonMappings, uint8_t{ 0 });
+    inline constexpr auto SdlToTbxMouseButtons = Detail::BuildSdlToTbx<SdlMouseButtonCount>(MouseButtonMappings);
+    inline constexpr auto TbxToSdlGamepadButtons = Detail::BuildTbxToSdl<Detail::GetTbxTableSize(GamepadButtonMappings)>(GamepadButtonMappings, SDL_GAMEPAD_BUTTON_INVALID);
+    inline constexpr auto SdlToTbxGamepadButtons = Detail::BuildSdlToTbx<SDL_GAMEPAD_BUTTON_COUNT>(GamepadButtonMappings);
+    inline constexpr auto TbxToSdlGamepadAxes = Detail::BuildTbxToSdl<Detail::GetTbxTableSize(GamepadAxisMappings)>(GamepadAxisMappings, SDL_GAMEPAD_AXIS_INVALID);
+    inline constexpr auto SdlToTbxGamepadAxes = Detail::BuildSdlToTbx<SDL_GAMEPAD_AXIS_COUNT>(GamepadAxisMappings);
+
+    // Spot checks that the generated tables agree with the mapping lists.
+    static_assert(TbxToSdlKeys[TBX_KEY_SPACE] == SDL_SCANCODE_SPACE && SdlToTbxKeys[SDL_SCANCODE_MENU] == TBX_KEY_MENU);
+    static_assert(TbxToSdlGamepadButtons[TBX_GAMEPAD_BUTTON_DPAD_LEFT] == SDL_GAMEPAD_BUTTON_DPAD_LEFT);
+
+    // Convert TBX key to SDL_Scancode
+    constexpr SDL_Scancode ConvertKey(int tbxKey)
+    {
+        return Detail::Lookup(TbxToSdlKeys, tbxKey, SDL_SCANCODE_UNKNOWN);
+    }
+
+    // Convert SDL_Scancode to TBX key, or -1 when TBX has no matching key
+    constexpr int ConvertScancode(SDL_Scancode scancode)
+    {
+        return Detail::Lookup(SdlToTbxKeys, scancode, -1);
     }
 
     // Mouse buttons
-    inline uint8_t ConvertMouseButton(int tbxButton)
+    constexpr uint8_t ConvertMouseButton(int tbxButton)
     {
-        switch (tbxButton)
-        {
-            case TBX_MOUSE_BUTTON_LEFT:   return SDL_BUTTON_LEFT;
-            case TBX_MOUSE_BUTTON_RIGHT:  return SDL_BUTTON_RIGHT;
-            case TBX_MOUSE_BUTTON_MIDDLE: return SDL_BUTTON_MIDDLE;
-            case TBX_MOUSE_BUTTON_4:      return SDL_BUTTON_X1;
-            case TBX_MOUSE_BUTTON_5:      return SDL_BUTTON_X2;
-            default:                      return 0;
-        }
+        return Detail::Lookup(TbxToSdlMouseButtons, tbxButton, uint8_t{ 0 });
+    }
+
+    constexpr int ConvertSDLMouseButton(uint8_t sdlButton)
+    {
+        return Detail::Lookup(SdlToTbxMouseButtons, sdlButton, -1);
     }
 
     // Gamepad buttons
-    inline SDL_GamepadButton ConvertGamepadButton(int tbxButton)
+    constexpr SDL_GamepadButton ConvertGamepadButton(int tbxButton)
     {
-        switch (tbxButton)
-        {
-            case TBX_GAMEPAD_BUTTON_SOUTH:        return SDL_GAMEPAD_BUTTON_SOUTH;
-            case TBX_GAMEPAD_BUTTON_EAST:         return SDL_GAMEPAD_BUTTON_EAST;
-            case TBX_GAMEPAD_BUTTON_WEST:         return SDL_GAMEPAD_BUTTON_WEST;
-            case TBX_GAMEPAD_BUTTON_NORTH:        return SDL_GAMEPAD_BUTTON_NORTH;
-            case TBX_GAMEPAD_BUTTON_LEFT_BUMPER:  return SDL_GAMEPAD_BUTTON_LEFT_SHOULDER;
-            case TBX_GAMEPAD_BUTTON_RIGHT_BUMPER: return SDL_GAMEPAD_BUTTON_RIGHT_SHOULDER;
-            case TBX_GAMEPAD_BUTTON_BACK:         return SDL_GAMEPAD_BUTTON_BACK;
-            case TBX_GAMEPAD_BUTTON_START:        return SDL_GAMEPAD_BUTTON_START;
-            case TBX_GAMEPAD_BUTTON_GUIDE:        return SDL_GAMEPAD_BUTTON_GUIDE;
-            case TBX_GAMEPAD_BUTTON_LEFT_THUMB:   return SDL_GAMEPAD_BUTTON_LEFT_STICK;
-            case TBX_GAMEPAD_BUTTON_RIGHT_THUMB:  return SDL_GAMEPAD_BUTTON_RIGHT_STICK;
-            case TBX_GAMEPAD_BUTTON_DPAD_UP:      return SDL_GAMEPAD_BUTTON_DPAD_UP;
-            case TBX_GAMEPAD_BUTTON_DPAD_RIGHT:   return SDL_GAMEPAD_BUTTON_DPAD_RIGHT;
-            case TBX_GAMEPAD_BUTTON_DPAD_DOWN:    return SDL_GAMEPAD_BUTTON_DPAD_DOWN;
-            case TBX_GAMEPAD_BUTTON_DPAD_LEFT:    return SDL_GAMEPAD_BUTTON_DPAD_LEFT;
-            default:                              return SDL_GAMEPAD_BUTTON_INVALID;
-        }
+        return Detail::Lookup(TbxToSdlGamepadButtons, tbxButton, SDL_GAMEPAD_BUTTON_INVALID);
+    }
+
+    constexpr int ConvertSDLGamepadButton(SDL_GamepadButton sdlButton)
+    {
+        return Detail::Lookup(SdlToTbxGamepadButtons, sdlButton, -1);
     }
 
     // Gamepad axes
-    inline SDL_GamepadAxis ConvertGamepadAxis(int tbxAxis)
+    constexpr SDL_GamepadAxis ConvertGamepadAxis(int tbxAxis)
     {
-        switch (tbxAxis)
-        {
-            case TBX_GAMEPAD_AXIS_LEFT_X:        return SDL_GAMEPAD_AXIS_LEFTX;
-            case TBX_GAMEPAD_AXIS_LEFT_Y:        return SDL_GAMEPAD_AXIS_LEFTY;
-            case TBX_GAMEPAD_AXIS_RIGHT_X:       return SDL_GAMEPAD_AXIS_RIGHTX;
-            case TBX_GAMEPAD_AXIS_RIGHT_Y:       return SDL_GAMEPAD_AXIS_RIGHTY;
-            case TBX_GAMEPAD_AXIS_LEFT_TRIGGER:  return SDL_GAMEPAD_AXIS_LEFT_TRIGGER;
-            case TBX_GAMEPAD_AXIS_RIGHT_TRIGGER: return SDL_GAMEPAD_AXIS_RIGHT_TRIGGER;
-            default:                             return SDL_GAMEPAD_AXIS_INVALID;
-        }
+        return Detail::Lookup(TbxToSdlGamepadAxes, tbxAxis, SDL_GAMEPAD_AXIS_INVALID);
+    }
+
+    constexpr int ConvertSDLGamepadAxis(SDL_GamepadAxis sdlAxis)
+    {
+        return Detail::Lookup(SdlToTbxGamepadAxes, sdlAxis, -1);
     }
 
     // Modifiers
@@ -0,0 +1,211 @@
+#include "SDLTbxInputCodeConverters.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+// Microbenchmark of the generated TBX -> SDL code tables against the switch statements they
+// replaced, which are kept below as the reference implementation.
+//
+// Usage: SDLInputCodeBenchmark [iterations]
+//
+// Every TBX code the reference maps is first checked to convert identically, then both
+// paths convert the same shuffled stream of codes, including unmapped ones.
+
+using namespace Tbx::Plugins::SDLInput;
+
+namespace
+{
+    // The pre-table switches, unchanged.
+    SDL_Scancode ReferenceConvertKey(int tbxKey)
+    {
+        switch (tbxKey)
+        {
+            case TBX_KEY_SPACE:          return SDL_SCANCODE_SPACE;
+            case TBX_KEY_APOSTROPHE:     return SDL_SCANCODE_APOSTROPHE;
+            case TBX_KEY_COMMA:          return SDL_SCANCODE_COMMA;
+            case TBX_KEY_MINUS:          return SDL_SCANCODE_MINUS;
+            case TBX_KEY_PERIOD:         return SDL_SCANCODE_PERIOD;
+            case TBX_KEY_SLASH:          return SDL_SCANCODE_SLASH;
+            case TBX_KEY_0:              return SDL_SCANCODE_0;
+            case TBX_KEY_1:              return SDL_SCANCODE_1;
+            case TBX_KEY_2:              return SDL_SCANCODE_2;
+            case TBX_KEY_3:              return SDL_SCANCODE_3;
+            case TBX_KEY_4:              return SDL_SCANCODE_4;
+            case TBX_KEY_5:              return SDL_SCANCODE_5;
+            case TBX_KEY_6:              return SDL_SCANCODE_6;
+            case TBX_KEY_7:              return SDL_SCANCODE_7;
+            case TBX_KEY_8:              return SDL_SCANCODE_8;
+            case TBX_KEY_9:              return SDL_SCANCODE_9;
+            case TBX_KEY_A:              return SDL_SCANCODE_A;
+            case TBX_KEY_B:              return SDL_SCANCODE_B;
+            case TBX_KEY_C:              return SDL_SCANCODE_C;
+            case TBX_KEY_D:              return SDL_SCANCODE_D;
+            case TBX_KEY_E:              return SDL_SCANCODE_E;
+            case TBX_KEY_F:              return SDL_SCANCODE_F;
+            case TBX_KEY_G:              return SDL_SCANCODE_G;
+            case TBX_KEY_H:              return SDL_SCANCODE_H;
+            case TBX_KEY_I:              return SDL_SCANCODE_I;
+            case TBX_KEY_J:              return SDL_SCANCODE_J;
+            case TBX_KEY_K:              return SDL_SCANCODE_K;
+            case TBX_KEY_L:              return SDL_SCANCODE_L;
+            case TBX_KEY_M:              return SDL_SCANCODE_M;
+            case TBX_KEY_N:              return SDL_SCANCODE_N;
+            case TBX_KEY_O:              return SDL_SCANCODE_O;
+            case TBX_KEY_P:              return SDL_SCANCODE_P;
+            case TBX_KEY_Q:              return SDL_SCANCODE_Q;
+            case TBX_KEY_R:              return SDL_SCANCODE_R;
+            case TBX_KEY_S:              return SDL_SCANCODE_S;
+            case TBX_KEY_T:              return SDL_SCANCODE_T;
+            case TBX_KEY_U:              return SDL_SCANCODE_U;
+            case TBX_KEY_V:              return SDL_SCANCODE_V;
+            case TBX_KEY_W:              return SDL_SCANCODE_W;
+            case TBX_KEY_X:              return SDL_SCANCODE_X;
+            case TBX_KEY_Y:              return SDL_SCANCODE_Y;
+            case TBX_KEY_Z:              return SDL_SCANCODE_Z;
+            case TBX_KEY_ESCAPE:         return SDL_SCANCODE_ESCAPE;
+            case TBX_KEY_ENTER:          return SDL_SCANCODE_RETURN;
+            case TBX_KEY_TAB:            return SDL_SCANCODE_TAB;
+            case TBX_KEY_BACKSPACE:      return SDL_SCANCODE_BACKSPACE;
+            case TBX_KEY_INSERT:         return SDL_SCANCODE_INSERT;
+            case TBX_KEY_DELETE:         return SDL_SCANCODE_DELETE;
+            case TBX_KEY_RIGHT:          return SDL_SCANCODE_RIGHT;
+            case TBX_KEY_LEFT:           return SDL_SCANCODE_LEFT;
+            case TBX_KEY_DOWN:           return SDL_SCANCODE_DOWN;
+            case TBX_KEY_UP:             return SDL_SCANCODE_UP;
+            case TBX_KEY_PAGE_UP:        return SDL_SCANCODE_PAGEUP;
+            case TBX_KEY_PAGE_DOWN:      return SDL_SCANCODE_PAGEDOWN;
+            case TBX_KEY_HOME:           return SDL_SCANCODE_HOME;
+            case TBX_KEY_END:            return SDL_SCANCODE_END;
+            case TBX_KEY_CAPS_LOCK:      return SDL_SCANCODE_CAPSLOCK;
+            case TBX_KEY_SCROLL_LOCK:    return SDL_SCANCODE_SCROLLLOCK;
+            case TBX_KEY_NUM_LOCK:       return SDL_SCANCODE_NUMLOCKCLEAR;
+            case TBX_KEY_PRINT_SCREEN:   return SDL_SCANCODE_PRINTSCREEN;
+            case TBX_KEY_PAUSE:          return SDL_SCANCODE_PAUSE;
+            case TBX_KEY_F1:             return SDL_SCANCODE_F1;
+            case TBX_KEY_F2:             return SDL_SCANCODE_F2;
+            case TBX_KEY_F3:             return SDL_SCANCODE_F3;
+            case TBX_KEY_F4:             return SDL_SCANCODE_F4;
+            case TBX_KEY_F5:             return SDL_SCANCODE_F5;
+            case TBX_KEY_F6:             return SDL_SCANCODE_F6;
+            case TBX_KEY_F7:             return SDL_SCANCODE_F7;
+            case TBX_KEY_F8:             return SDL_SCANCODE_F8;
+            case TBX_KEY_F9:             return SDL_SCANCODE_F9;
+            case TBX_KEY_F10:            return SDL_SCANCODE_F10;
+            case TBX_KEY_F11:            return SDL_SCANCODE_F11;
+            case TBX_KEY_F12:            return SDL_SCANCODE_F12;
+            case TBX_KEY_KP_0:           return SDL_SCANCODE_KP_0;
+            case TBX_KEY_KP_1:           return SDL_SCANCODE_KP_1;
+            case TBX_KEY_KP_2:           return SDL_SCANCODE_KP_2;
+            case TBX_KEY_KP_3:           return SDL_SCANCODE_KP_3;
+            case TBX_KEY_KP_4:           return SDL_SCANCODE_KP_4;
+            case TBX_KEY_KP_5:           return SDL_SCANCODE_KP_5;
+            case TBX_KEY_KP_6:           return SDL_SCANCODE_KP_6;
+            case TBX_KEY_KP_7:           return SDL_SCANCODE_KP_7;
+            case TBX_KEY_KP_8:           return SDL_SCANCODE_KP_8;
+            case TBX_KEY_KP_9:           return SDL_SCANCODE_KP_9;
+            case TBX_KEY_LEFT_SHIFT:     return SDL_SCANCODE_LSHIFT;
+            case TBX_KEY_LEFT_CONTROL:   return SDL_SCANCODE_LCTRL;
+            case TBX_KEY_LEFT_ALT:       return SDL_SCANCODE_LALT;
+            case TBX_KEY_LEFT_SUPER:     return SDL_SCANCODE_LGUI;
+            case TBX_KEY_RIGHT_SHIFT:    return SDL_SCANCODE_RSHIFT;
+            case TBX_KEY_RIGHT_CONTROL:  return SDL_SCANCODE_RCTRL;
+            case TBX_KEY_RIGHT_ALT:      return SDL_SCANCODE_RALT;
+            case TBX_KEY_RIGHT_SUPER:    return SDL_SCANCODE_RGUI;
+            case TBX_KEY_MENU:           return SDL_SCANCODE_MENU;
+            default:                     return SDL_SCANCODE_UNKNOWN;
+        }
+    }
+
+    SDL_GamepadButton ReferenceConvertGamepadButton(int tbxButton)
+    {
+        switch (tbxButton)
+        {
+            case TBX_GAMEPAD_BUTTON_SOUTH:        return SDL_GAMEPAD_BUTTON_SOUTH;
+            case TBX_GAMEPAD_BUTTON_EAST:         return SDL_GAMEPAD_BUTTON_EAST;
+            case TBX_GAMEPAD_BUTTON_WEST:         return SDL_GAMEPAD_BUTTON_WEST;
+            case TBX_GAMEPAD_BUTTON_NORTH:        return SDL_GAMEPAD_BUTTON_NORTH;
+            case TBX_GAMEPAD_BUTTON_LEFT_BUMPER:  return SDL_GAMEPAD_BUTTON_LEFT_SHOULDER;
+            case TBX_GAMEPAD_BUTTON_RIGHT_BUMPER: return SDL_GAMEPAD_BUTTON_RIGHT_SHOULDER;
+            case TBX_GAMEPAD_BUTTON_BACK:         return SDL_GAMEPAD_BUTTON_BACK;
+            case TBX_GAMEPAD_BUTTON_START:        return SDL_GAMEPAD_BUTTON_START;
+            case TBX_GAMEPAD_BUTTON_GUIDE:        return SDL_GAMEPAD_BUTTON_GUIDE;
+            case TBX_GAMEPAD_BUTTON_LEFT_THUMB:   return SDL_GAMEPAD_BUTTON_LEFT_STICK;
+            case TBX_GAMEPAD_BUTTON_RIGHT_THUMB:  return SDL_GAMEPAD_BUTTON_RIGHT_STICK;
+            case TBX_GAMEPAD_BUTTON_DPAD_UP:      return SDL_GAMEPAD_BUTTON_DPAD_UP;
+            case TBX_GAMEPAD_BUTTON_DPAD_RIGHT:   return SDL_GAMEPAD_BUTTON_DPAD_RIGHT;
+            case TBX_GAMEPAD_BUTTON_DPAD_DOWN:    return SDL_GAMEPAD_BUTTON_DPAD_DOWN;
+            case TBX_GAMEPAD_BUTTON_DPAD_LEFT:    return SDL_GAMEPAD_BUTTON_DPAD_LEFT;
+            default:                              return SDL_GAMEPAD_BUTTON_INVALID;
+        }
+    }
+
+    template <typename TConvert>
+    double MeasureNs(const std::vector<int>& codes, size_t iterations, TConvert convert)
+    {
+        // Summing the results keeps the conversions from being optimized away. The code
+        // count is a power of two, so indexing is a mask.
+        long long sink = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            sink += static_cast<long long>(convert(codes[i & (codes.size() - 1)]));
+        }
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        volatile long long keep = sink;
+        (void)keep;
+        return std::chrono::duration<double, std::nano>(elapsed).count() / static_cast<double>(iterations);
+    }
+
+    template <typename TReference, typename TTable>
+    bool Compare(const char* name, const std::vector<int>& codes, size_t iterations, TReference reference, TTable table)
+    {
+        for (int code = -1; code <= 512; ++code)
+        {
+            const auto expected = reference(code);
+            const auto actual = table(code);
+            // The tables also cover codes the switch never handled.
+            if (static_cast<long long>(expected) != static_cast<long long>(actual) && static_cast<long long>(expected) != static_cast<long long>(reference(-1)))
+            {
+                std::fprintf(stderr, "%s: code %d converts to %lld, expected %lld\n", name, code, static_cast<long long>(actual), static_cast<long long>(expected));
+                return false;
+            }
+        }
+
+        const double switchNs = MeasureNs(codes, iterations, reference);
+        const double tableNs = MeasureNs(codes, iterations, table);
+        std::printf("%-16s switch %6.2f ns  table %6.2f ns  (%.1fx)\n", name, switchNs, tableNs, switchNs / tableNs);
+        return true;
+    }
+
+    std::vector<int> MakeCodes(int first, int last, size_t count)
+    {
+        std::mt19937 random(1234);
+        std::uniform_int_distribution<int> pick(first, last);
+        std::vector<int> codes(count);
+        for (int& code : codes)
+        {
+            code = pick(random);
+        }
+        return codes;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const size_t iterations = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100000000ull;
+    if (iterations == 0)
+    {
+        std::fprintf(stderr, "Usage: SDLInputCodeBenchmark [iterations]\n");
+        return 1;
+    }
+
+    // A long random stream, so the branch predictor cannot learn the sequence.
+    const std::vector<int> keys = MakeCodes(0, TBX_KEY_MENU, 1 << 16);
+    const std::vector<int> buttons = MakeCodes(0, TBX_GAMEPAD_BUTTON_DPAD_LEFT, 1 << 16);
+
+    bool ok = Compare("ConvertKey", keys, iterations, ReferenceConvertKey, [](int code) { return ConvertKey(code); });
+    ok = Compare("ConvertButton", buttons, iterations, ReferenceConvertGamepadButton, [](int code) { return ConvertGamepadButton(code); }) && ok;
+    return ok ? 0 : 1;
+}
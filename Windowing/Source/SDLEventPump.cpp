@@ -0,0 +1,115 @@
+#include "SDLEventPump.h"
+#include "SDLWindow.h"
+#include <SDL3/SDL_timer.h>
+#include <algorithm>
+
+namespace Tbx::Plugins::SDLWindowing
+{
+    void SDLEventPump::Register(SDL_WindowID id, SDLWindow* window)
+    {
+        if (id == 0)
+        {
+            return;
+        }
+
+        if (_windows.size() <= id)
+        {
+            _windows.resize(static_cast<size_t>(id) + 1, nullptr);
+            _updatedSinceDrain.resize(static_cast<size_t>(id) + 1, false);
+        }
+        _windows[id] = window;
+    }
+
+    void SDLEventPump::Unregister(SDL_WindowID id)
+    {
+        if (id < _windows.size())
+        {
+            _windows[id] = nullptr;
+            if (_updatedSinceDrain[id])
+            {
+                _updatedSinceDrain[id] = false;
+                _updatedCount--;
+            }
+        }
+    }
+
+    void SDLEventPump::OnWindowUpdate(SDL_WindowID id)
+    {
+        // A closed window has no id to track, so it drains every time it updates.
+        const bool tracked = id != 0 && id < _updatedSinceDrain.size();
+        if (!tracked || _updatedCount == 0 || _updatedSinceDrain[id])
+        {
+            Pump();
+            std::fill(_updatedSinceDrain.begin(), _updatedSinceDrain.end(), false);
+            _updatedCount = 0;
+        }
+
+        // Draining may have closed the window and unregistered it.
+        if (tracked && _windows[id] != nullptr)
+        {
+            _updatedSinceDrain[id] = true;
+            _updatedCount++;
+        }
+    }
+
+    void SDLEventPump::Pump()
+    {
+        const Uint64 start = SDL_GetTicksNS();
+        SDL_PumpEvents();
+
+        SDL_Event batch[BatchSize];
+        Uint32 eventCount = 0;
+        int received = 0;
+        do
+        {
+            received = SDL_PeepEvents(batch, BatchSize, SDL_GETEVENT, SDL_EVENT_FIRST, SDL_EVENT_LAST);
+            for (int i = 0; i < received; ++i)
+            {
+                Dispatch(batch[i]);
+            }
+            eventCount += received > 0 ? static_cast<Uint32>(received) : 0;
+        } while (received == BatchSize);
+
+        // Calls that found nothing to do keep the last drain's numbers.
+        if (eventCount == 0)
+        {
+            return;
+        }
+
+        const Uint64 elapsed = SDL_GetTicksNS() - start;
+        _stats.LastDrainNs = elapsed;
+        _stats.LastEventCount = eventCount;
+        _stats.PeakDrainNs = elapsed > _stats.PeakDrainNs ? elapsed : _stats.PeakDrainNs;
+    }
+
+    const EventPumpStats& SDLEventPump::GetStats() const
+    {
+        return _stats;
+    }
+
+    void SDLEventPump::Dispatch(const SDL_Event& event)
+    {
+        if (event.type == SDL_EVENT_QUIT)
+        {
+            // Quit concerns every window. Copy first, as handling it closes and unregisters.
+            const std::vector<SDLWindow*> windows = _windows;
+            for (SDLWindow* window : windows)
+            {
+                if (window != nullptr)
+                {
+                    window->OnSDLEvent(event);
+                }
+            }
+            return;
+        }
+
+        if (event.type >= SDL_EVENT_WINDOW_FIRST && event.type <= SDL_EVENT_WINDOW_LAST)
+        {
+            const SDL_WindowID id = event.window.windowID;
+            if (id < _windows.size() && _windows[id] != nullptr)
+            {
+                _windows[id]->OnSDLEvent(event);
+            }
+        }
+    }
+}
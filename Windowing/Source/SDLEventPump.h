@@ -0,0 +1,48 @@
+#pragma once
+#include <SDL3/SDL_events.h>
+#include <SDL3/SDL_stdinc.h>
+#include <SDL3/SDL_video.h>
+#include <vector>
+
+namespace Tbx::Plugins::SDLWindowing
+{
+    class SDLWindow;
+
+    struct EventPumpStats
+    {
+        Uint64 LastDrainNs = 0;
+        Uint64 PeakDrainNs = 0;
+        Uint32 LastEventCount = 0;
+    };
+
+    // Shared by every window the factory creates. The SDL queue is drained once per frame in
+    // batches, and window events are handed to the window they belong to, so no window steals
+    // another's events and nothing waits in the queue for later frames. Input is not routed
+    // here; the input plugin sees it through its event watch as events are queued.
+    class SDLEventPump
+    {
+    public:
+        void Register(SDL_WindowID id, SDLWindow* window);
+        void Unregister(SDL_WindowID id);
+
+        // Called from every window's Update. Only the first call of a frame drains the queue:
+        // a window updating again before the next drain means a new frame has started.
+        void OnWindowUpdate(SDL_WindowID id);
+
+        const EventPumpStats& GetStats() const;
+
+    private:
+        void Pump();
+        void Dispatch(const SDL_Event& event);
+
+    private:
+        static constexpr int BatchSize = 64;
+
+        // Indexed by SDL_WindowID, which SDL hands out as small increasing integers.
+        std::vector<SDLWindow*> _windows = {};
+        // Windows that have updated since the last drain, indexed like _windows.
+        std::vector<bool> _updatedSinceDrain = {};
+        size_t _updatedCount = 0;
+        EventPumpStats _stats = {};
+    };
+}
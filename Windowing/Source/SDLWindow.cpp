@@ -1,12 +1,14 @@
 #include "SDLWindow.h"
 #include "Tbx/Debug/Asserts.h"
+#include "Tbx/Debug/Tracers.h"
 #include "Tbx/Events/WindowEvents.h"
 #include <SDL3/SDL_events.h>
+#include <string_view>
 
 namespace Tbx::Plugins::SDLWindowing
 {
-    SDLWindow::SDLWindow(bool useOpenGl, Ref<EventBus> eventBus)
-        : _eventCarrier(eventBus), _useOpenGl(useOpenGl)
+    SDLWindow::SDLWindow(bool useOpenGl, bool headless, Ref<EventBus> eventBus, Ref<SDLEventPump> eventPump)
+        : _eventCarrier(eventBus), _eventPump(eventPump), _useOpenGl(useOpenGl), _headless(headless)
     {
     }
 
@@ -30,10 +32,23 @@ namespace Tbx::Plugins::SDLWindowing
         _isClosed = false;
         Uint32 flags = SDL_WINDOW_RESIZABLE;
 
-        if (_useOpenGl)
+        // The dummy driver cannot host GL, so asking for it would fail window creation.
+        const char* driver = SDL_GetCurrentVideoDriver();
+        const bool canUseOpenGl = driver == nullptr || std::string_view(driver) != "dummy";
+        if (_useOpenGl && canUseOpenGl)
         {
             flags |= SDL_WINDOW_OPENGL;
         }
+        else if (_useOpenGl)
+        {
+            TBX_TRACE_WARNING("SDLWindow: The dummy video driver has no OpenGL support, opening '{}' without it.", _title);
+        }
+
+        // Headless windows are render targets only; there is nothing to show them on.
+        if (_headless)
+        {
+            flags |= SDL_WINDOW_HIDDEN;
+        }
 
         switch (_currentMode)
         {
@@ -56,6 +71,8 @@ namespace Tbx::Plugins::SDLWindowing
 
         _window = SDL_CreateWindow(_title.c_str(), _size.Width, _size.Height, flags);
         TBX_ASSERT(_window, "SDLWindow: SDL_CreateWindow failed: %s", SDL_GetError());
+        _windowId = SDL_GetWindowID(_window);
+        _eventPump->Register(_windowId, this);
         _eventCarrier.Post(WindowOpenedEvent(this));
     }
 
@@ -65,66 +82,112 @@ namespace Tbx::Plugins::SDLWindowing
         if (_window == nullptr) return;
 
         // Cleanup...
+        _eventPump->Unregister(_windowId);
+        _windowId = 0;
         SDL_DestroyWindow(_window);
         _window = nullptr;
         _isClosed = true;
 
-        if (_useOpenGl)
+        _eventCarrier.Post(WindowClosedEvent(this));
+    }
+
+    void SDLWindow::Update()
+    {
+        // The first window to update each frame drains the queue for all of them; our own
+        // events come back through OnSDLEvent, which keeps size, mode and focus current
+        // without querying the windowing system.
+        _eventPump->OnWindowUpdate(_windowId);
+        if (_window == nullptr)
         {
-            // Reset the context
-            SDL_GL_DestroyContext(_glContext);
+            return;
         }
 
-        _eventCarrier.Post(WindowClosedEvent(this));
+        // A drag produces a resize per mouse move; listeners hear about the final size once.
+        if (_resizePending)
+        {
+            _resizePending = false;
+            _eventCarrier.Post(WindowResizedEvent(this));
+        }
     }
 
-    void SDLWindow::Update()
+    void SDLWindow::OnSDLEvent(const SDL_Event& event)
     {
-        SDL_Event e = {};
-        SDL_PollEvent(&e);
-        switch (e.type)
+        switch (event.type)
         {
             case SDL_EVENT_QUIT:
+            case SDL_EVENT_WINDOW_CLOSE_REQUESTED:
             {
                 Close();
                 break;
             }
+            case SDL_EVENT_WINDOW_RESIZED:
+            {
+                _size = Size(event.window.data1, event.window.data2);
+                _resizePending = true;
+                break;
+            }
+            case SDL_EVENT_WINDOW_MINIMIZED:
+            {
+                ApplyModeFromEvent(WindowMode::Minimized);
+                break;
+            }
+            case SDL_EVENT_WINDOW_RESTORED:
+            {
+                if (_currentMode == WindowMode::Minimized)
+                {
+                    ApplyModeFromEvent(_restoreMode);
+                }
+                break;
+            }
+            case SDL_EVENT_WINDOW_ENTER_FULLSCREEN:
+            {
+                const bool borderless = _currentMode == WindowMode::Borderless || _currentMode == WindowMode::FullscreenBorderless;
+                ApplyModeFromEvent(borderless ? WindowMode::FullscreenBorderless : WindowMode::Fullscreen);
+                break;
+            }
+            case SDL_EVENT_WINDOW_LEAVE_FULLSCREEN:
+            {
+                if (_currentMode == WindowMode::FullscreenBorderless)
+                {
+                    ApplyModeFromEvent(WindowMode::Borderless);
+                }
+                else if (_currentMode == WindowMode::Fullscreen)
+                {
+                    ApplyModeFromEvent(WindowMode::Windowed);
+                }
+                break;
+            }
+            case SDL_EVENT_WINDOW_FOCUS_GAINED:
+            {
+                if (!_isFocused)
+                {
+                    _isFocused = true;
+                    _eventCarrier.Post(WindowFocusedEvent(this));
+                }
+                break;
+            }
+            case SDL_EVENT_WINDOW_FOCUS_LOST:
+            {
+                _isFocused = false;
+                break;
+            }
         }
+    }
 
-        int w, h;
-        SDL_GetWindowSize(_window, &w, &h);
-        SetSize(Size(w, h));
-
-        auto flags = SDL_GetWindowFlags(_window);
-        if (flags & SDL_WINDOW_FULLSCREEN)
-        {
-            SetMode(WindowMode::Fullscreen);
-        }
-        else if (flags & SDL_WINDOW_FULLSCREEN & SDL_WINDOW_BORDERLESS)
-        {
-            SetMode(WindowMode::FullscreenBorderless);
-        }
-        else if (flags & SDL_WINDOW_BORDERLESS)
-        {
-            SetMode(WindowMode::Borderless);
-        }
-        else if (flags & SDL_WINDOW_MINIMIZED)
-        {
-            SetMode(WindowMode::Minimized);
-        }
-        else
+    void SDLWindow::ApplyModeFromEvent(WindowMode mode)
+    {
+        // The window is already in this mode, so only our record and listeners need updating.
+        if (mode == _currentMode)
         {
-            SetMode(WindowMode::Windowed);
+            return;
         }
 
-        if (flags & SDL_WINDOW_INPUT_FOCUS)
-        {
-            Focus();
-        }
-        else
+        if (mode == WindowMode::Minimized)
         {
-            _isFocused = false;
+            _restoreMode = _currentMode;
         }
+        _currentMode = mode;
+        _eventCarrier.Post(WindowModeChangedEvent(this));
     }
 
     void SDLWindow::Focus()
@@ -135,11 +198,9 @@ namespace Tbx::Plugins::SDLWindowing
         }
 
         _isFocused = true;
+        // GL contexts belong to the graphics context plugin, which binds whichever window
+        // it renders to; focus has no say in it.
         SDL_RaiseWindow(_window);
-        if (_useOpenGl)
-        {
-            SDL_GL_MakeCurrent(_window, _glContext);
-        }
         _eventCarrier.Post(WindowFocusedEvent(this));
     }
 
@@ -177,14 +238,19 @@ namespace Tbx::Plugins::SDLWindowing
 
     void SDLWindow::SetSize(const Size& size)
     {
+        if (_size.Width == size.Width && _size.Height == size.Height)
+        {
+            return;
+        }
+
         _size = size;
-        if (_size.GetAspectRatio() == size.GetAspectRatio())
+        if (_window == nullptr)
         {
             return;
         }
 
+        // SDL answers with a resize event, which posts WindowResizedEvent on the next Update.
         SDL_SetWindowSize(_window, _size.Width, _size.Height);
-        _eventCarrier.Post(WindowResizedEvent(this));
     }
 
     void SDLWindow::SetMode(const WindowMode& mode)
@@ -194,6 +260,10 @@ namespace Tbx::Plugins::SDLWindowing
             return;
         }
 
+        if (mode == WindowMode::Minimized)
+        {
+            _restoreMode = _currentMode;
+        }
         _currentMode = mode;
         if (_window == nullptr)
         {
@@ -2,6 +2,7 @@
 #include "Tbx/Windowing/Window.h"
 #include "Tbx/Plugins/Plugin.h"
 #include "Tbx/Events/EventCarrier.h"
+#include "SDLEventPump.h"
 #include <SDL3/SDL_video.h>
 
 namespace Tbx::Plugins::SDLWindowing
@@ -9,7 +10,7 @@ namespace Tbx::Plugins::SDLWindowing
     class SDLWindow : public Window, public IProductOfPluginFactory
     {
     public:
-        SDLWindow(bool useOpenGl, Ref<EventBus> eventBus);
+        SDLWindow(bool useOpenGl, bool headless, Ref<EventBus> eventBus, Ref<SDLEventPump> eventPump);
         ~SDLWindow() override;
 
         NativeHandle GetNativeHandle() const override;
@@ -32,16 +33,27 @@ namespace Tbx::Plugins::SDLWindowing
         void SetMode(const WindowMode& mode) override;
         WindowMode GetMode() const override;
 
+        // Called by the event pump with events addressed to this window, and with quit.
+        void OnSDLEvent(const SDL_Event& event);
+
+    private:
+        void ApplyModeFromEvent(WindowMode mode);
+
     private:
-        SDL_GLContext _glContext = nullptr;
         SDL_Window* _window = nullptr;
         EventCarrier _eventCarrier = {};
+        Ref<SDLEventPump> _eventPump = nullptr;
+        SDL_WindowID _windowId = 0;
         WindowMode _currentMode = WindowMode::Windowed;
+        // The mode to return to when a minimized window is restored.
+        WindowMode _restoreMode = WindowMode::Windowed;
         Size _size = { 800, 800 };
         std::string _title = "New Window";
         bool _isFocused = false;
         bool _isClosed = false;
+        bool _resizePending = false;
         bool _useOpenGl = false;
+        bool _headless = false;
     };
 }
 
@@ -1,14 +1,28 @@
 #include "SDLWindowFactoryPlugin.h"
 #include "SDLWindow.h"
+#include "Tbx/Debug/Tracers.h"
+#include <SDL3/SDL_hints.h>
 #include <SDL3/SDL_init.h>
+#include <SDL3/SDL_stdinc.h>
+#include <string_view>
 
 namespace Tbx::Plugins::SDLWindowing
 {
     SDLWindowFactoryPlugin::SDLWindowFactoryPlugin(Ref<EventBus> eventBus)
         : _listener(eventBus)
+        , _eventPump(std::make_shared<SDLEventPump>())
         , _usingOpenGl(false)
     {
-        TBX_ASSERT(SDL_Init(SDL_INIT_VIDEO) != 0, "Failed to initialize SDL");
+        _headless = ShouldRunHeadless();
+        if (_headless)
+        {
+            const bool initialized = InitHeadlessVideo();
+            TBX_ASSERT(initialized, "Failed to initialize a headless SDL video driver");
+        }
+        else
+        {
+            TBX_ASSERT(SDL_Init(SDL_INIT_VIDEO) != 0, "Failed to initialize SDL");
+        }
         _listener.Listen<AppSettingsChangedEvent>([this](const AppSettingsChangedEvent& e) { OnAppSettingsChanged(e); });
     }
 
@@ -25,13 +39,59 @@ namespace Tbx::Plugins::SDLWindowing
 
     std::shared_ptr<Window> SDLWindowFactoryPlugin::Create(const std::string& title, const Size& size, const WindowMode& mode, Ref<EventBus> eventBus)
     {
-        auto window = FactoryPlugin<SDLWindow>::Create(_usingOpenGl, eventBus);
+        auto window = FactoryPlugin<SDLWindow>::Create(_usingOpenGl, _headless, eventBus, _eventPump);
         window->SetTitle(title);
         window->SetSize(size);
         window->SetMode(mode);
         return window;
     }
 
+    bool SDLWindowFactoryPlugin::IsHeadless() const
+    {
+        return _headless;
+    }
+
+    bool SDLWindowFactoryPlugin::ShouldRunHeadless()
+    {
+        // Opt-in only: a host without X11 or Wayland may still have a display through
+        // KMSDRM or a console driver.
+        const char* requested = SDL_getenv("TBX_HEADLESS");
+        return requested != nullptr && std::string_view(requested) != "0";
+    }
+
+    bool SDLWindowFactoryPlugin::InitHeadlessVideo()
+    {
+        // Opt-in for hosts with no GPU: Mesa can still provide GL through llvmpipe. These only
+        // take effect where Mesa is the GL implementation, and never override the user's
+        // environment.
+        if (const char* software = SDL_getenv("TBX_HEADLESS_SOFTWARE_GL"); software != nullptr && std::string_view(software) != "0")
+        {
+            SDL_setenv_unsafe("LIBGL_ALWAYS_SOFTWARE", "1", 0);
+            SDL_setenv_unsafe("GALLIUM_DRIVER", "llvmpipe", 0);
+        }
+
+        // Offscreen hosts GL contexts through EGL; dummy cannot, but needs nothing at all.
+        for (const char* driver : { "offscreen", "dummy" })
+        {
+            SDL_SetHint(SDL_HINT_VIDEO_DRIVER, driver);
+            if (SDL_InitSubSystem(SDL_INIT_VIDEO))
+            {
+                TBX_TRACE_INFO("SDLWindowing: Running headless on the '{}' video driver.", driver);
+                if (std::string_view(driver) == "dummy")
+                {
+                    TBX_TRACE_WARNING("SDLWindowing: The dummy video driver cannot create OpenGL contexts; windows open without OpenGL.");
+                }
+                return true;
+            }
+        }
+        return false;
+    }
+
+    const EventPumpStats& SDLWindowFactoryPlugin::GetEventPumpStats() const
+    {
+        return _eventPump->GetStats();
+    }
+
     void SDLWindowFactoryPlugin::OnAppSettingsChanged(const AppSettingsChangedEvent& e)
     {
         _usingOpenGl = e.NewSettings.RenderingApi == GraphicsApi::OpenGL;
@@ -20,12 +20,26 @@ namespace Tbx::Plugins::SDLWindowing
             const WindowMode& mode,
             Ref<EventBus> eventBus) override;
 
+        // Headless runs use SDL's offscreen video driver, or the dummy driver where offscreen
+        // is unavailable, so the engine loop runs with no display server. Enabled at startup
+        // by setting TBX_HEADLESS to anything but 0. TBX_HEADLESS_SOFTWARE_GL=1 makes Mesa
+        // render GL in software for hosts with no GPU. Windows skip OpenGL on dummy, so no GL
+        // context can be provided for them.
+        bool IsHeadless() const;
+
+        // Time the shared event pump spent on its last non-empty drain.
+        const EventPumpStats& GetEventPumpStats() const;
+
     private:
         void OnAppSettingsChanged(const AppSettingsChangedEvent& e);
+        static bool ShouldRunHeadless();
+        static bool InitHeadlessVideo();
 
     private:
         EventListener _listener = {};
+        Ref<SDLEventPump> _eventPump = nullptr;
         bool _usingOpenGl = false;
+        bool _headless = false;
     };
 
     TBX_REGISTER_PLUGIN(SDLWindowFactoryPlugin);